@@ -29,8 +29,8 @@ SOFTWARE.
 #include "ImCoolBar.h"
 #include "imgui_internal.h"
 #include <cmath>
-#include <vector>
-#include <array>
+#include <chrono>
+#include <cstdlib>
 
 #ifndef IMCOOLBAR_HAS_DOCKING
 #if defined(IMGUI_HAS_DOCK)
@@ -44,9 +44,53 @@ SOFTWARE.
 #define ICB_DOCKING_HOST_FLAGS 0
 #endif
 
+// SIMD paths of the bubble kernel (define IMCOOLBAR_DISABLE_SIMD to force the scalar path)
+#ifndef IMCOOLBAR_DISABLE_SIMD
+#if defined(__AVX__)
+#define ICB_SIMD_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ICB_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define ICB_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
 #define ICB_PREFIX "ICB"
+#define ICB_SETTLE_EPSILON_PX 0.05f  // sizes/positions closer than this to their target are snapped
+#ifndef IMCOOLBAR_GC_FRAMES
+#define IMCOOLBAR_GC_FRAMES 300  // frames a bar's buffers stay mostly unused before their capacity is released
+#endif
+#ifndef IMCOOLBAR_LABEL_CACHE_VTX
+#define IMCOOLBAR_LABEL_CACHE_VTX 16384  // cached label vertices per bar before the label cache starts over
+#endif
+#define ICB_LABEL_SIZE_STEP 0.5f  // label font sizes are quantized to this step (px)
+#define ICB_QUALITY_AVG_MS 250.0f   // half-life of the frame time average watched by the quality governor
+#define ICB_QUALITY_DOWN_S 0.5f     // time over budget before the quality steps down
+#define ICB_QUALITY_UP_S   2.0f     // time well under budget before the quality steps back up
+#define ICB_GRID_CELL_PX   256.0f   // cell size of the per-context grid that finds the bars near the pointer
+#define ICB_GRID_MAX_CELLS 64       // bars covering more cells than this are tested on every frame instead
+#define ICB_EMA_ALPHAS_MAX 8        // distinct EMA half-lives whose alpha is shared per frame
+#define ICB_LAYOUT_BLOCK   8        // items refined together by the batch kernel in CoolBarLayout() (one AVX lane set)
+#define ICB_LAYOUT_EPSILON_PX 0.001f  // CoolBarLayout() stops refining a block once no size moves by more than this
+#define ICB_EXACT_LAYOUT_PASSES 8   // refining passes per block allowed to the exact layout solve
 //#define ENABLE_IMCOOLBAR_DEBUG
 
+// Chrome trace export of the hot paths (off by default, compiled out entirely)
+#ifdef IMCOOLBAR_ENABLE_TRACE
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#ifndef IMCOOLBAR_TRACE_MAX_EVENTS
+#define IMCOOLBAR_TRACE_MAX_EVENTS (1 << 18)  // events kept until the next SaveCoolBarTrace()
+#endif
+#endif
+
 #ifdef _MSC_VER
 #include <Windows.h>
 #define ICB_DEBUG_BREAK       \
@@ -59,16 +103,987 @@ SOFTWARE.
 #define BREAK_ON_KEY(KEY)         \
     if (ImGui::IsKeyPressed(KEY)) \
     ICB_DEBUG_BREAK
-    
+
+/// \brief One icon quad queued by \c CoolBarIcon() and drawn in \c EndCoolBar().
+struct ImCoolBarIconQuad {
+    ImVec2 Min;  ///< Top-left corner (screen px).
+    ImVec2 Max;  ///< Bottom-right corner (screen px).
+    ImVec2 UV0;  ///< Atlas UV of \c Min.
+    ImVec2 UV1;  ///< Atlas UV of \c Max.
+    ImU32  Col;  ///< Tint color.
+};
+
+/// \brief One \c CoolBarLabel() held back while icon quads are pending, drawn over them by \c flushIconQuads().
+struct ImCoolBarPendingLabel {
+    int     Slot;       ///< Entry in \c ImCoolBarState::Labels.
+    ImVec2  Pos;        ///< Text origin (screen px).
+    ImU32   Col;        ///< Text color.
+    ImFont* Font;       ///< Font of the label.
+    float   FontSize;   ///< Quantized font size.
+    int     TextStart;  ///< First char in \c ImCoolBarState::PendingLabelText.
+    int     TextEnd;    ///< End of the text in \c ImCoolBarState::PendingLabelText.
+    bool    Capture;    ///< The label is fully visible: keep its glyphs in the label cache.
+};
+
+/// \brief One text layout of the per-bar label cache.
+struct ImCoolBarLabelEntry {
+    ImGuiID Key;       ///< Hash of the font, the quantized font size and the text.
+    ImVec2  Size;      ///< Measured text extent.
+    int     VtxStart;  ///< First vertex in \c ImCoolBarState::LabelVtx.
+    int     VtxCount;  ///< Glyph vertices (-1 while only the extent is known).
+    int     IdxStart;  ///< First index in \c ImCoolBarState::LabelIdx.
+    int     IdxCount;  ///< Glyph indices.
+};
+
+/// \brief One draw command of the static-frame cache.
+struct ImCoolBarCachedCmd {
+    ImVec4 ClipRect;  ///< Clip rectangle of the command.
+#if IMGUI_VERSION_NUM >= 19200
+    ImTextureRef Tex; ///< Texture of the command.
+#else
+    ImTextureID  Tex; ///< Texture of the command.
+#endif
+    int    IdxCount;  ///< Indices of the command in \c ImCoolBarState::CacheIdx.
+};
+
+/// \brief Per-bar state, resolved once in \c BeginCoolBar() and indexed directly by items.
+struct ImCoolBarState {
+    ImGuiID          WindowID            = 0;                    ///< Owning window ID (pool key).
+    ImCoolBarFlags   Flags               = ImCoolBarFlags_None;  ///< Orientation flags.
+    float            Anchor              = 0.0f;                 ///< Cross-axis anchor [0..1].
+    float            NormalSize          = 0.0f;                 ///< Default item size (px).
+    float            HoveredSize         = 0.0f;                 ///< Fully hovered item size (px).
+    float            EffectStrength      = 0.0f;                 ///< Bubble effect strength.
+    float            AnimScale           = 0.0f;                 ///< Hover ramp [0..1].
+    float            AnimSmoothingMs     = 0.0f;                 ///< Anim EMA half-life (ms).
+    float            AnimSmoothingAlpha  = 0.0f;                 ///< Anim EMA alpha of this frame.
+    float            MouseSmoothingMs    = 0.0f;                 ///< Mouse EMA half-life (ms).
+    float            MouseSmoothingAlpha = 0.0f;                 ///< Mouse EMA alpha of this frame.
+    float            MouseSmoothing      = 0.0f;                 ///< Mouse EMA accumulator.
+    bool             MouseSmoothingInit  = false;                ///< Mouse EMA was seeded.
+    bool             MouseReseedPending  = false;                ///< Reseed mouse EMA on next valid sample.
+    float            LastMousePos        = 0.0f;                 ///< Filtered mouse position on the main axis.
+    ImCoolBarMouseFilter MouseFilter     = ImCoolBarMouseFilter_Ema; ///< Mouse filter of this frame.
+    float            MouseVelocity       = 0.0f;                 ///< One Euro speed estimate (px/s).
+    float            MouseRawPrev        = 0.0f;                 ///< Raw mouse position of the previous frame.
+    bool             MouseRawPrevValid   = false;                ///< \c MouseRawPrev holds a sample.
+    float            MouseFilterDelayMs  = 0.0f;                 ///< Smoothed lag of the filtered mouse behind the raw one (ms).
+    bool             SnapItemsToPixels   = true;                 ///< Snap item offsets to integer pixels.
+    bool             SnapWindowToPixels  = true;                 ///< Snap window position to integer pixels.
+    ImDrawListFlags  PrevDLFlags         = 0;                    ///< Draw list flags to restore in \c EndCoolBar().
+    bool             PrevDLFlagsSet      = false;                ///< \c PrevDLFlags must be restored.
+    bool             PushedRounding      = false;                ///< FrameRounding was pushed.
+    int              ItemIdx             = 0;                    ///< Index of the next item (item count after \c EndCoolBar()).
+    float            ItemCurrentSize     = 0.0f;                 ///< Size of the last item.
+    float            ItemCurrentScale    = 0.0f;                 ///< Scale of the last item.
+    ImVector<float>  ItemSizes;                                  ///< Per-item sizes, indexed by item index.
+    bool             AnimSettled         = true;                 ///< \c AnimScale reached its target.
+    bool             MouseSettled        = true;                 ///< Filtered mouse reached the raw mouse.
+    bool             ItemsChanged        = false;                ///< An item size or the item count changed this frame.
+    bool             Animating           = false;                ///< Another frame is needed (set in \c EndCoolBar()).
+    int              LastActiveFrame     = -1;                   ///< Last frame the bar was submitted.
+    double           LastActiveTime      = 0.0;                  ///< \c ImGui::GetTime() of the last submission.
+    bool             CollectTimings      = false;                ///< Fill the timing fields of \c Stats.
+    int              StatsVtxStart       = 0;                    ///< Draw list vertex count after \c Begin().
+    int              StatsIdxStart       = 0;                    ///< Draw list index count after \c Begin().
+    ImCoolBarStats   Stats;                                      ///< Counters of the current/last frame.
+    int              ClipperStart        = 0;                    ///< First item submitted through \c ImCoolBarClipper last frame.
+    int              ClipperEnd          = 0;                    ///< End of the items submitted through \c ImCoolBarClipper last frame.
+    ImVector<ImCoolBarIconQuad> IconQuads;                       ///< Icon quads batched until \c EndCoolBar().
+    ImTextureID      IconAtlas           = ImTextureID();        ///< Texture shared by \c IconQuads.
+    int              IconQuadsPeak       = 0;                    ///< Largest icon batch of the current frame.
+    ImVector<ImCoolBarPendingLabel> PendingLabels;               ///< Labels drawn after \c IconQuads, so icons do not cover them.
+    ImVector<char>   PendingLabelText;                           ///< Text of \c PendingLabels (callers' strings may not live until the flush).
+    bool             IconClickPending    = false;                ///< A click on the bar has not been matched to an icon yet.
+    bool             Hovered             = false;                ///< The bar window was hovered in \c BeginCoolBar().
+    bool             CacheValid          = false;                ///< The retained geometry matches \c CacheKey.
+    bool             CacheReplaying      = false;                ///< This frame replays the retained geometry (items are skipped).
+    bool             CacheCapturing      = false;                ///< This frame is static and its geometry gets retained.
+    ImGuiID          CacheKey            = 0;                    ///< Hash of everything that shapes a static frame.
+    bool             CacheUnsafe         = false;                ///< Content was drawn outside items during a replay: the cache is off.
+    int              ItemsVtxStart       = -1;                   ///< Draw list vertex count at the first \c CoolBarItem() of the frame (-1 = none yet).
+    int              ItemsIdxStart       = 0;                    ///< Draw list index count at the first \c CoolBarItem() of the frame.
+    int              CacheItemsCount     = 0;                    ///< Item count of the retained frame.
+    ImVec2           CacheCursorMaxPos;                          ///< \c DC.CursorMaxPos of the retained frame.
+    ImVec2           CacheIdealMaxPos;                           ///< \c DC.IdealMaxPos of the retained frame.
+    ImVector<ImDrawVert>         CacheVtx;                       ///< Retained vertices.
+    ImVector<ImDrawIdx>          CacheIdx;                       ///< Retained indices, relative to \c CacheVtx.
+    ImVector<ImCoolBarCachedCmd> CacheCmds;                      ///< Retained draw commands.
+    ImVector<float>  ExactSizes;                                 ///< Exact layout: item sizes solved before Begin() (empty otherwise).
+    ImVector<float>  ExactOffsets;                               ///< Exact layout: cross-axis item offsets solved before Begin().
+    int              LastFullFrame       = -1;                   ///< Last frame the item buffers were at least half used.
+    float            AnimVelocity        = 0.0f;                 ///< Hover ramp spring velocity (1/s).
+    float            ItemSpringOmega     = 0.0f;                 ///< Item size spring angular frequency (0 = items jump to their bubble size).
+    ImVector<float>  ItemVelocities;                             ///< Item size spring velocities (px/s), indexed like \c ItemSizes.
+    bool             ItemsSpringing      = false;                ///< An item spring has not settled this frame.
+    ImVec2           ItemCurrentPos;                             ///< Screen position of the last item.
+    ImVector<ImCoolBarLabelEntry> Labels;                        ///< Cached label layouts.
+    ImGuiStorage     LabelMap;                                   ///< Label key -> index in \c Labels.
+    ImVector<ImDrawVert> LabelVtx;                               ///< Label glyph vertices relative to the text origin.
+    ImVector<ImDrawIdx>  LabelIdx;                               ///< Label indices relative to the entry's first vertex.
+    ImGuiID          LabelAtlasKey       = 0;                    ///< Font atlas state the cached glyph UVs belong to.
+    ImCoolBarQuality QualityLevel        = ImCoolBarQuality_Full; ///< Level chosen by the adaptive quality governor.
+    int              QualityFrame        = -1;                   ///< Frame the governor last ran.
+    float            QualityFrameMs      = 0.0f;                 ///< Averaged frame time watched by the governor.
+    float            QualityTimer        = 0.0f;                 ///< >0: time over budget, <0: time well under budget (s).
+    float            BubbleSupport       = FLT_MAX;              ///< Adaptive quality: items farther than this from the mouse stay normal...
+    float            BubbleNextLobe      = FLT_MAX;              ///< ...unless they are this far or farther (next lobe of the curve).
+    ImRect           WakeRect;                                   ///< Window rect grown by the hovered size: the pointer inside it wakes the bar.
+    int              WakeRectFrame       = -1;                   ///< Frame \c WakeRect was recorded in \c EndCoolBar().
+    int              WakeFrame           = -1;                   ///< Last frame the pointer was inside \c WakeRect.
+    bool             Dormant             = false;                ///< Settled and away from the pointer: the motion update was skipped.
+};
+
+/// \brief One grid cell covered by a bar's \c WakeRect.
+struct ImCoolBarGridEntry {
+    ImU32     Cell;  ///< Packed cell coordinates.
+    ImPoolIdx Bar;   ///< Pool index of the bar.
+};
+
+/// \brief EMA alpha of one half-life, shared by all bars during a frame.
+struct ImCoolBarEmaAlpha {
+    float HalfLifeMs;
+    float DtMs;
+    float Alpha;
+};
+
+/// \brief CoolBar data owned by one ImGui context.
+struct ImCoolBarContext {
+    ImPool<ImCoolBarState> Bars;                     ///< Bar states keyed by window ID.
+    ImVector<ImPoolIdx>    Registry;                 ///< Pool indices of the live bars.
+    ImVector<ImPoolIdx>    BarStack;                 ///< Pool indices of the bars between Begin/End.
+    ImCoolBarState*        CurrentBar     = nullptr; ///< Innermost bar between Begin/End.
+    int                    LastPruneFrame = -1;      ///< Frame of the last registry pruning.
+    int                    NextItemsCount = -1;      ///< Set by \c SetNextCoolBarItemsCount() for the next bar.
+    int                    PointerFrame   = -1;      ///< Frame the pointer service last ran.
+    ImVector<ImCoolBarGridEntry> Grid;               ///< Wake rect cells of the live bars, sorted by cell.
+    ImVector<ImPoolIdx>    GridLarge;                ///< Bars whose wake rect covers too many cells, tested every frame.
+    bool                   GridDirty      = true;    ///< A wake rect moved or a bar was removed: rebuild \c Grid.
+    ImVector<ImCoolBarEmaAlpha> EmaAlphas;           ///< EMA alphas computed this frame.
+};
+
 namespace {
 
-    static float bubbleEffect(const float vValue, const float vStength) {
-        return pow(cos(vValue * IM_PI * vStength), 12.0f);
+    // Context of the bars open on this thread: set by BeginCoolBar(), cleared by the last EndCoolBar(),
+    // so CoolBarItem() and the item helpers do not scan the context hooks
+    static thread_local ImGuiContext*     s_open_owner_ptr = nullptr;
+    static thread_local ImCoolBarContext* s_open_ctx_ptr   = nullptr;
+
+    static void onContextShutdown(ImGuiContext* /*vCtx*/, ImGuiContextHook* vHook) {
+        ImCoolBarContext* ctx_ptr = (ImCoolBarContext*)vHook->UserData;
+        if (s_open_ctx_ptr == ctx_ptr) {
+            s_open_owner_ptr = nullptr;
+            s_open_ctx_ptr   = nullptr;
+        }
+        IM_DELETE(ctx_ptr);
+        vHook->UserData = nullptr;
+    }
+
+    // The CoolBar context lives in a shutdown hook of the current ImGui context,
+    // so every ImGui context gets its own bars and frees them on DestroyContext().
+    static ImCoolBarContext* getCoolBarContext() {
+        static const ImGuiID s_owner_id = ImHashStr(ICB_PREFIX "Context");
+        ImGuiContext& g = *GImGui;
+        for (const ImGuiContextHook& hook : g.Hooks) {
+            if (hook.Owner == s_owner_id && hook.Type == ImGuiContextHookType_Shutdown) {
+                return (ImCoolBarContext*)hook.UserData;
+            }
+        }
+        ImCoolBarContext* ctx_ptr = IM_NEW(ImCoolBarContext)();
+        ImGuiContextHook hook;
+        hook.Type     = ImGuiContextHookType_Shutdown;
+        hook.Owner    = s_owner_id;
+        hook.Callback = onContextShutdown;
+        hook.UserData = ctx_ptr;
+        ImGui::AddContextHook(&g, &hook);
+        return ctx_ptr;
     }
 
-    // https://codesandbox.io/s/motion-dock-forked-hs4p8d?file=/src/Dock.tsx
-    static float getHoverSize(const float vValue, const float vNormalSize, const float vHoveredSize, const float vStength, const float vScale) {
-        return ImClamp(vNormalSize + (vHoveredSize - vNormalSize) * bubbleEffect(vValue, vStength) * vScale, vNormalSize, vHoveredSize);
+    static ImCoolBarContext* getOpenCoolBarContext() {
+        return s_open_owner_ptr == GImGui ? s_open_ctx_ptr : getCoolBarContext();
+    }
+
+    // ImPool::Remove() leaves a key -> -1 entry in the pool map: drop it, or generated bar labels grow the map forever
+    static void eraseStorageKey(ImGuiStorage& vStorage, const ImGuiID vKey) {
+        int lo = 0, hi = vStorage.Data.Size;
+        while (lo < hi) {
+            const int mid = (lo + hi) / 2;
+            if (vStorage.Data[mid].key < vKey) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo < vStorage.Data.Size && vStorage.Data[lo].key == vKey) {
+            vStorage.Data.erase(vStorage.Data.Data + lo);
+        }
+    }
+
+    // Bars not submitted for io.ConfigMemoryCompactTimer seconds are freed, like ImGui compacts windows.
+    // Runs once per frame from the first BeginCoolBar(), never while a bar is open (pool indices are on the stack).
+    static void pruneCoolBars(ImCoolBarContext& vCtx) {
+        ImGuiContext& g = *GImGui;
+        if (vCtx.LastPruneFrame == g.FrameCount || !vCtx.BarStack.empty()) {
+            return;
+        }
+        vCtx.LastPruneFrame = g.FrameCount;
+        if (g.IO.ConfigMemoryCompactTimer < 0.0f) {
+            return;
+        }
+        const double threshold = g.Time - (double)g.IO.ConfigMemoryCompactTimer;
+        for (int n = vCtx.Registry.Size - 1; n >= 0; --n) {
+            const ImPoolIdx pool_idx = vCtx.Registry[n];
+            const ImCoolBarState* bar_ptr = vCtx.Bars.GetByIndex(pool_idx);
+            if (bar_ptr->LastActiveTime < threshold) {
+                const ImGuiID window_id = bar_ptr->WindowID;
+                vCtx.Bars.Remove(window_id, pool_idx);
+                eraseStorageKey(vCtx.Bars.Map, window_id);
+                vCtx.Registry.erase_unsorted(vCtx.Registry.Data + n);
+                vCtx.GridDirty = true;
+            }
+        }
+
+        // Bars created and destroyed over time (one per document tab...) leave free slots behind: once most of the
+        // pool is free, the live states are relocated into a dense pool. States are moved with memcpy, as ImPool
+        // itself does when it grows, and the registry indices are rebuilt.
+        if (vCtx.Bars.GetBufSize() > vCtx.Registry.Size * 2 + 8) {
+            ImVector<ImCoolBarState> live_bars; // raw storage: no constructor/destructor runs on it
+            live_bars.resize(vCtx.Registry.Size);
+            for (int n = 0; n < vCtx.Registry.Size; ++n) {
+                memcpy((void*)&live_bars[n], (const void*)vCtx.Bars.GetByIndex(vCtx.Registry[n]), sizeof(ImCoolBarState));
+            }
+            vCtx.Bars.Buf.clear(); // ownership moved to live_bars: free the slots without destroying them
+            vCtx.Bars.Map.Clear();
+            vCtx.Bars.FreeIdx    = 0;
+            vCtx.Bars.AliveCount = 0;
+            vCtx.Bars.Reserve(live_bars.Size);
+            for (int n = 0; n < live_bars.Size; ++n) {
+                ImCoolBarState* bar_ptr = vCtx.Bars.GetOrAddByKey(live_bars[n].WindowID); // default state owns no memory
+                memcpy((void*)bar_ptr, (const void*)&live_bars[n], sizeof(ImCoolBarState));
+                vCtx.Registry[n] = vCtx.Bars.GetIndex(bar_ptr);
+            }
+            vCtx.GridDirty = true;
+        }
+    }
+
+    static ImU32 getGridCell(const int vX, const int vY) {
+        return ((ImU32)vY << 16) ^ ((ImU32)vX & 0xFFFF);
+    }
+
+    // Cells covered by a rect: x0, y0, x1, y1 (inclusive)
+    static void getGridRange(const ImRect& vRect, int vOutRange[4]) {
+        vOutRange[0] = (int)ImFloor(vRect.Min.x / ICB_GRID_CELL_PX);
+        vOutRange[1] = (int)ImFloor(vRect.Min.y / ICB_GRID_CELL_PX);
+        vOutRange[2] = (int)ImFloor(vRect.Max.x / ICB_GRID_CELL_PX);
+        vOutRange[3] = (int)ImFloor(vRect.Max.y / ICB_GRID_CELL_PX);
+    }
+
+    static int compareGridEntries(const void* vLhs, const void* vRhs) {
+        const ImU32 a = ((const ImCoolBarGridEntry*)vLhs)->Cell;
+        const ImU32 b = ((const ImCoolBarGridEntry*)vRhs)->Cell;
+        return (a > b) - (a < b);
+    }
+
+    static void rebuildBarGrid(ImCoolBarContext& vCtx) {
+        vCtx.Grid.resize(0);
+        vCtx.GridLarge.resize(0);
+        for (const ImPoolIdx pool_idx : vCtx.Registry) {
+            const ImCoolBarState* bar_ptr = vCtx.Bars.GetByIndex(pool_idx);
+            if (bar_ptr->WakeRectFrame < 0) {
+                continue;
+            }
+            int range[4];
+            getGridRange(bar_ptr->WakeRect, range);
+            if ((range[2] - range[0] + 1) * (range[3] - range[1] + 1) > ICB_GRID_MAX_CELLS) {
+                vCtx.GridLarge.push_back(pool_idx);
+                continue;
+            }
+            for (int y = range[1]; y <= range[3]; ++y) {
+                for (int x = range[0]; x <= range[2]; ++x) {
+                    ImCoolBarGridEntry entry;
+                    entry.Cell = getGridCell(x, y);
+                    entry.Bar  = pool_idx;
+                    vCtx.Grid.push_back(entry);
+                }
+            }
+        }
+        if (vCtx.Grid.Size > 1) {
+            qsort(vCtx.Grid.Data, (size_t)vCtx.Grid.Size, sizeof(ImCoolBarGridEntry), compareGridEntries);
+        }
+        vCtx.GridDirty = false;
+    }
+
+    static void wakeBarAt(ImCoolBarContext& vCtx, const ImPoolIdx vPoolIdx, const ImVec2& vPos, const int vFrame) {
+        ImCoolBarState* bar_ptr = vCtx.Bars.GetByIndex(vPoolIdx);
+        if (bar_ptr->WakeRect.Contains(vPos)) {
+            bar_ptr->WakeFrame = vFrame;
+        }
+    }
+
+    // The pointer is resolved once per frame for all bars: the grid of last frame's wake rects yields the few bars
+    // near the pointer, every other bar that has settled skips its hover ramp and mouse filter (see updateBarMotion()).
+    // With hundreds of small bars on a page, the per-frame cost then no longer grows with the number of bars.
+    static void updatePointerService(ImCoolBarContext& vCtx) {
+        const int frame = ImGui::GetFrameCount();
+        if (vCtx.PointerFrame == frame) {
+            return;
+        }
+        vCtx.PointerFrame = frame;
+        vCtx.EmaAlphas.resize(0);
+        if (vCtx.GridDirty) {
+            rebuildBarGrid(vCtx);
+        }
+        if (!ImGui::IsMousePosValid()) {
+            return;
+        }
+        const ImVec2 mouse = ImGui::GetMousePos();
+        const ImU32  cell  = getGridCell((int)ImFloor(mouse.x / ICB_GRID_CELL_PX), (int)ImFloor(mouse.y / ICB_GRID_CELL_PX));
+        int lo = 0, hi = vCtx.Grid.Size; // lower bound of the pointer's cell
+        while (lo < hi) {
+            const int mid = (lo + hi) / 2;
+            if (vCtx.Grid[mid].Cell < cell) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        for (int n = lo; n < vCtx.Grid.Size && vCtx.Grid[n].Cell == cell; ++n) {
+            wakeBarAt(vCtx, vCtx.Grid[n].Bar, mouse, frame);
+        }
+        for (const ImPoolIdx pool_idx : vCtx.GridLarge) {
+            wakeBarAt(vCtx, pool_idx, mouse, frame);
+        }
+    }
+
+    // alpha = 1 - exp(-ln(2) * dt / HL), computed once per frame for each half-life in use
+    static float getEmaAlpha(ImCoolBarContext& vCtx, const float vHalfLifeMs, const float vDtMs) {
+        for (const ImCoolBarEmaAlpha& entry : vCtx.EmaAlphas) {
+            if (entry.HalfLifeMs == vHalfLifeMs && entry.DtMs == vDtMs) {
+                return entry.Alpha;
+            }
+        }
+        const float k     = 0.69314718056f; // ln(2)
+        const float alpha = ImClamp(1.0f - expf(-k * (vDtMs / vHalfLifeMs)), 0.0f, 1.0f);
+        if (vCtx.EmaAlphas.Size < ICB_EMA_ALPHAS_MAX) {
+            ImCoolBarEmaAlpha entry;
+            entry.HalfLifeMs = vHalfLifeMs;
+            entry.DtMs       = vDtMs;
+            entry.Alpha      = alpha;
+            vCtx.EmaAlphas.push_back(entry);
+        }
+        return alpha;
+    }
+
+    // Distances from the filtered mouse between which the bubble adds less than ICB_SETTLE_EPSILON_PX to an item:
+    // beyond vOutSupport the main lobe has faded, and from vOutNextLobe on the next lobe of the periodic cos^12
+    // (period pi) rises again, which strong effects bring inside the bar. FLT_MAX support: every item is enlarged.
+    static void getBubbleSupport(const float vNormalSize, const float vHoveredSize, const float vStength, const float vBarExtent, float& vOutSupport, float& vOutNextLobe) {
+        vOutNextLobe = FLT_MAX;
+        if (vHoveredSize <= vNormalSize) {
+            vOutSupport = 0.0f;
+            return;
+        }
+        if (vStength <= 0.0f) {
+            vOutSupport = FLT_MAX;
+            return;
+        }
+        const float eps   = ImMin(ICB_SETTLE_EPSILON_PX / (vHoveredSize - vNormalSize), 1.0f);
+        const float phase = acosf(powf(eps, 1.0f / 12.0f)); // |x| where the main lobe falls below eps
+        const float scale = vBarExtent / (IM_PI * vStength);  // distance per radian of x
+        vOutSupport  = phase * scale;
+        vOutNextLobe = (IM_PI - phase) * scale;
+    }
+
+#if IMGUI_VERSION_NUM >= 19200
+    static void pushTexture(ImDrawList* vDrawList, ImTextureRef vTex) { vDrawList->PushTexture(vTex); }
+    static void popTexture(ImDrawList* vDrawList) { vDrawList->PopTexture(); }
+#else
+    static void pushTexture(ImDrawList* vDrawList, ImTextureID vTex) { vDrawList->PushTextureID(vTex); }
+    static void popTexture(ImDrawList* vDrawList) { vDrawList->PopTextureID(); }
+#endif
+
+    // Shrinks the capacity to the size, or to vKeep elements for buffers refilled every frame
+    template <typename T>
+    static void compactVector(ImVector<T>& vVector, const int vKeep = 0) {
+        if (vVector.Capacity > ImMax(vVector.Size, vKeep)) {
+            ImVector<T> compacted;
+            compacted.reserve(ImMax(vVector.Size, vKeep));
+            compacted.resize(vVector.Size);
+            if (vVector.Size > 0) {
+                memcpy((void*)compacted.Data, (const void*)vVector.Data, (size_t)vVector.Size * sizeof(T));
+            }
+            vVector.swap(compacted);
+        }
+    }
+
+    // Releases the capacity of per-item buffers once the bar used at most half of it for IMCOOLBAR_GC_FRAMES frames
+    // (item count went down, clipper range or batch got smaller).
+    static void compactBarBuffers(ImCoolBarState& vBar) {
+        const int frame = ImGui::GetFrameCount();
+        if (vBar.ItemSizes.Capacity <= vBar.ItemSizes.Size * 2 + 16 && vBar.IconQuads.Capacity <= vBar.IconQuadsPeak * 2 + 64) {
+            vBar.LastFullFrame = frame;
+            return;
+        }
+        if (frame - vBar.LastFullFrame < IMCOOLBAR_GC_FRAMES) {
+            return;
+        }
+        compactVector(vBar.ItemSizes);
+        compactVector(vBar.ExactSizes);
+        compactVector(vBar.ExactOffsets);
+        compactVector(vBar.IconQuads, vBar.IconQuadsPeak); // empty outside Begin/End: keep this frame's batch
+        compactVector(vBar.CacheVtx);
+        compactVector(vBar.CacheIdx);
+        compactVector(vBar.CacheCmds);
+        compactVector(vBar.Labels);
+        compactVector(vBar.LabelVtx);
+        compactVector(vBar.LabelIdx);
+        vBar.LastFullFrame = frame;
+    }
+
+    static size_t getBarFootprint(const ImCoolBarState& vBar) {
+        return sizeof(ImCoolBarState) +                                          //
+               (size_t)vBar.ItemSizes.Capacity * sizeof(float) +                 //
+               (size_t)(vBar.ExactSizes.Capacity + vBar.ExactOffsets.Capacity) * sizeof(float) +  //
+               (size_t)vBar.IconQuads.Capacity * sizeof(ImCoolBarIconQuad) +     //
+               (size_t)vBar.PendingLabels.Capacity * sizeof(ImCoolBarPendingLabel) +  //
+               (size_t)vBar.PendingLabelText.Capacity +                        //
+               (size_t)vBar.CacheVtx.Capacity * sizeof(ImDrawVert) +             //
+               (size_t)vBar.CacheIdx.Capacity * sizeof(ImDrawIdx) +              //
+               (size_t)vBar.CacheCmds.Capacity * sizeof(ImCoolBarCachedCmd) +   //
+               (size_t)vBar.Labels.Capacity * sizeof(ImCoolBarLabelEntry) +      //
+               (size_t)vBar.LabelMap.Data.Capacity * sizeof(*vBar.LabelMap.Data.Data) +  //
+               (size_t)vBar.LabelVtx.Capacity * sizeof(ImDrawVert) +             //
+               (size_t)vBar.LabelIdx.Capacity * sizeof(ImDrawIdx);
+    }
+
+    // Angular frequency of a critically damped spring that settles within 1% in vSettleMs ((1 + u) e^-u = 0.01 for u = 6.638)
+    static float getSpringOmega(const float vSettleMs) {
+        return vSettleMs > 0.0f ? 6.638f / (vSettleMs * 0.001f) : 0.0f;
+    }
+
+    // Critically damped spring toward vTarget, solved in closed form so any DeltaTime gives the same motion:
+    // x(t) = (x0 + (v0 + w x0) t) e^-wt. Snaps once the remaining excursion bound |x| + |v|/w is under vEpsilon.
+    static float stepSpring(const float vValue, float& vVelocity, const float vTarget, const float vOmega, const float vDt, const float vEpsilon) {
+        const float x0 = vValue - vTarget;
+        const float a  = vVelocity + vOmega * x0;
+        const float e  = expf(-vOmega * vDt);
+        const float x1 = (x0 + a * vDt) * e;
+        vVelocity = (vVelocity - vOmega * a * vDt) * e;
+        if (ImFabs(x1) + ImFabs(vVelocity) / vOmega < vEpsilon) {
+            vVelocity = 0.0f;
+            return vTarget;
+        }
+        return vTarget + x1;
+    }
+
+    // Alpha of a first-order low-pass with the given cutoff, sampled every vDt seconds
+    static float getLowPassAlpha(const float vCutoffHz, const float vDt) {
+        const float tau = 1.0f / (2.0f * IM_PI * ImMax(vCutoffHz, 1e-3f));
+        return 1.0f / (1.0f + tau / vDt);
+    }
+
+    // One Euro filter (Casiez et al., CHI 2012): the cutoff rises with the filtered speed, so slow motion is
+    // smoothed and fast sweeps are followed closely. The predictive mode extrapolates by the same speed estimate.
+    static float filterMouseOneEuro(ImCoolBarState& vBar, const ImCoolBarConfig& vConfig, const float vRaw, const float vDt, const bool vSeed) {
+        if (vSeed) {
+            vBar.MouseSmoothing     = vRaw;
+            vBar.MouseVelocity      = 0.0f;
+            vBar.MouseSmoothingInit = true;
+            vBar.MouseReseedPending = false;
+            return vRaw;
+        }
+        const float speed = (vRaw - vBar.MouseSmoothing) / vDt;
+        vBar.MouseVelocity += getLowPassAlpha(vConfig.mouse_deriv_cutoff_hz, vDt) * (speed - vBar.MouseVelocity);
+        const float cutoff = vConfig.mouse_min_cutoff_hz + vConfig.mouse_beta * ImFabs(vBar.MouseVelocity);
+        const float alpha  = getLowPassAlpha(cutoff, vDt);
+        vBar.MouseSmoothing += alpha * (vRaw - vBar.MouseSmoothing);
+        if (ImFabs(vRaw - vBar.MouseSmoothing) < ICB_SETTLE_EPSILON_PX) {
+            vBar.MouseSmoothing = vRaw;
+        }
+        vBar.MouseSmoothingAlpha = alpha;
+        float m_flt = vBar.MouseSmoothing;
+        if (vBar.MouseFilter == ImCoolBarMouseFilter_Predictive) {
+            // Capped so that a sudden stop overshoots by at most one item
+            const float lead = ImClamp(vBar.MouseVelocity * vConfig.mouse_prediction_ms * 0.001f, -vConfig.normal_size, vConfig.normal_size);
+            if (ImFabs(lead) >= ICB_SETTLE_EPSILON_PX) {
+                m_flt += lead;
+            }
+        }
+        return m_flt;
+    }
+
+    // Draws every queued icon with one texture and one draw command per 64k vertices
+    static void drawPendingLabels(ImCoolBarState& vBar, ImDrawList* vDrawList);
+
+    // Draws the batched icon quads, then the labels that came after them (labels sit on their icons)
+    static void flushIconQuads(ImCoolBarState& vBar, ImDrawList* vDrawList) {
+        if (vBar.IconQuads.empty()) {
+            return;
+        }
+        pushTexture(vDrawList, vBar.IconAtlas);
+        const int quads_per_chunk = (1 << 16) / 4 - 1; // keeps 16-bit indices valid without VtxOffset
+        for (int start = 0; start < vBar.IconQuads.Size; start += quads_per_chunk) {
+            const int count = ImMin(quads_per_chunk, vBar.IconQuads.Size - start);
+            vDrawList->PrimReserve(count * 6, count * 4);
+            for (int i = start; i < start + count; ++i) {
+                const ImCoolBarIconQuad& quad = vBar.IconQuads[i];
+                vDrawList->PrimRectUV(quad.Min, quad.Max, quad.UV0, quad.UV1, quad.Col);
+            }
+        }
+        popTexture(vDrawList);
+        vBar.IconQuadsPeak = ImMax(vBar.IconQuadsPeak, vBar.IconQuads.Size);
+        vBar.IconQuads.resize(0);
+        drawPendingLabels(vBar, vDrawList);
+    }
+
+    // Everything that shapes the geometry of an idle bar: a static frame is only replayed while this is unchanged.
+    // Item content is not part of it, see InvalidateCoolBarCache().
+    // A rebuilt or resized font atlas texture invalidates retained glyph UVs
+    static ImGuiID getFontAtlasKey(const ImGuiID vSeed) {
+        const ImFontAtlas* atlas_ptr = GImGui->IO.Fonts;
+#if IMGUI_VERSION_NUM >= 19200
+        ImGuiID key = ImHashData(&atlas_ptr->TexRef, sizeof(atlas_ptr->TexRef), vSeed);
+#else
+        ImGuiID key = ImHashData(&atlas_ptr->TexID, sizeof(atlas_ptr->TexID), vSeed);
+#endif
+        return ImHashData(&atlas_ptr->TexUvScale, sizeof(atlas_ptr->TexUvScale), key);
+    }
+
+    static void clearLabelCache(ImCoolBarState& vBar) {
+        vBar.Labels.resize(0); // keeps the capacity: the cache refills at the same size
+        vBar.LabelMap.Data.resize(0);
+        vBar.LabelVtx.resize(0);
+        vBar.LabelIdx.resize(0);
+    }
+
+    // Keeps the glyph quads AddText() just emitted, relative to the text origin, so the next frames only copy them
+    static void captureLabel(ImCoolBarState& vBar, ImCoolBarLabelEntry& vEntry, const ImDrawList* vDrawList, const ImVec2& vPos, const int vVtxStart, const int vIdxStart, const unsigned int vVtxBase) {
+        const int vtx_count = vDrawList->VtxBuffer.Size - vVtxStart;
+        const int idx_count = vDrawList->IdxBuffer.Size - vIdxStart;
+        if (vDrawList->_VtxCurrentIdx != vVtxBase + (unsigned int)vtx_count) {
+            return; // AddText() started a new VtxOffset: indices are not relative to vVtxBase
+        }
+        vEntry.VtxStart = vBar.LabelVtx.Size;
+        vEntry.IdxStart = vBar.LabelIdx.Size;
+        vEntry.VtxCount = vtx_count;
+        vEntry.IdxCount = idx_count;
+        vBar.LabelVtx.resize(vBar.LabelVtx.Size + vtx_count);
+        vBar.LabelIdx.resize(vBar.LabelIdx.Size + idx_count);
+        for (int i = 0; i < vtx_count; ++i) {
+            ImDrawVert& vtx = vBar.LabelVtx[vEntry.VtxStart + i];
+            vtx     = vDrawList->VtxBuffer[vVtxStart + i];
+            vtx.pos = vtx.pos - vPos;
+        }
+        for (int i = 0; i < idx_count; ++i) {
+            vBar.LabelIdx[vEntry.IdxStart + i] = (ImDrawIdx)(vDrawList->IdxBuffer[vIdxStart + i] - vVtxBase);
+        }
+    }
+
+    static void replayLabel(const ImCoolBarState& vBar, const ImCoolBarLabelEntry& vEntry, ImDrawList* vDrawList, const ImVec2& vPos, const ImU32 vCol) {
+        vDrawList->PrimReserve(vEntry.IdxCount, vEntry.VtxCount);
+        const unsigned int vtx_base = vDrawList->_VtxCurrentIdx; // read after PrimReserve(), which may start a new VtxOffset
+        const ImDrawVert* src_ptr = vBar.LabelVtx.Data + vEntry.VtxStart;
+        ImDrawVert* dst_ptr = vDrawList->_VtxWritePtr;
+        for (int i = 0; i < vEntry.VtxCount; ++i) {
+            dst_ptr[i].pos = src_ptr[i].pos + vPos;
+            dst_ptr[i].uv  = src_ptr[i].uv;
+            dst_ptr[i].col = vCol;
+        }
+        const ImDrawIdx* idx_ptr = vBar.LabelIdx.Data + vEntry.IdxStart;
+        for (int i = 0; i < vEntry.IdxCount; ++i) {
+            vDrawList->_IdxWritePtr[i] = (ImDrawIdx)(vtx_base + idx_ptr[i]);
+        }
+        vDrawList->_VtxWritePtr += vEntry.VtxCount;
+        vDrawList->_IdxWritePtr += vEntry.IdxCount;
+        vDrawList->_VtxCurrentIdx += (unsigned int)vEntry.VtxCount;
+    }
+
+    static void drawLabel(ImCoolBarState& vBar, const int vSlot, ImDrawList* vDrawList, ImFont* vFont, const float vFontSize, const ImVec2& vPos, const ImU32 vCol,
+                          const char* vText, const char* vTextEnd, const bool vCapture) {
+        ImCoolBarLabelEntry& entry = vBar.Labels[vSlot];
+        if (entry.VtxCount >= 0) {
+            replayLabel(vBar, entry, vDrawList, vPos, vCol);
+            return;
+        }
+        const int vtx_start = vDrawList->VtxBuffer.Size;
+        const int idx_start = vDrawList->IdxBuffer.Size;
+        const unsigned int vtx_base = vDrawList->_VtxCurrentIdx;
+        vDrawList->AddText(vFont, vFontSize, vPos, vCol, vText, vTextEnd);
+        if (vCapture) {
+            captureLabel(vBar, entry, vDrawList, vPos, vtx_start, idx_start, vtx_base); // clipped glyphs would be missing from the layout
+        }
+    }
+
+    static void drawPendingLabels(ImCoolBarState& vBar, ImDrawList* vDrawList) {
+        for (const ImCoolBarPendingLabel& label : vBar.PendingLabels) {
+            const char* text_ptr = vBar.PendingLabelText.Data;
+            drawLabel(vBar, label.Slot, vDrawList, label.Font, label.FontSize, label.Pos, label.Col, text_ptr + label.TextStart, text_ptr + label.TextEnd, label.Capture);
+        }
+        vBar.PendingLabels.resize(0);
+        vBar.PendingLabelText.resize(0);
+    }
+
+    static ImGuiID getStaticFrameKey(const ImCoolBarState& vBar, const ImCoolBarConfig& vConfig, const ImGuiWindow* vWindow) {
+        ImGuiContext& g = *GImGui;
+        const float fields[] = {
+            vWindow->Pos.x, vWindow->Pos.y, vWindow->Size.x, vWindow->Size.y, vWindow->Scroll.x, vWindow->Scroll.y,
+            vConfig.anchor.x, vConfig.anchor.y, vConfig.normal_size, vConfig.hovered_size, vConfig.frame_rounding_override,
+            (float)vBar.Flags, (float)vBar.ItemSizes.Size, (float)vConfig.local_antialiasing, (float)vConfig.snap_items_to_pixels, g.FontSize,
+            (float)vBar.QualityLevel,
+        };
+        ImGuiID key = ImHashData(fields, sizeof(fields));
+        key = ImHashData(&g.Style, sizeof(g.Style), key);
+        key = ImHashData(&g.Font, sizeof(g.Font), key);
+        return getFontAtlasKey(key);
+    }
+
+    // Draw commands holding indices emitted since BeginCoolBar() (a command the bar only extended counts too)
+    static int countDrawCmds(const ImCoolBarState& vBar, const ImDrawList* vDrawList) {
+        int count = 0;
+        for (const ImDrawCmd& cmd : vDrawList->CmdBuffer) {
+            if (cmd.ElemCount > 0 && (int)(cmd.IdxOffset + cmd.ElemCount) > vBar.StatsIdxStart) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    // Copies the geometry emitted since the first CoolBarItem() with indices made relative to its first vertex:
+    // content drawn between BeginCoolBar() and the first item is submitted again on replay frames, so it is left out.
+    // Fails (nothing to replay) on callbacks or on indices reaching vertices emitted before the first item.
+    static bool captureStaticGeometry(ImCoolBarState& vBar, const ImDrawList* vDrawList) {
+        vBar.CacheVtx.resize(0);
+        vBar.CacheIdx.resize(0);
+        vBar.CacheCmds.resize(0);
+        const int vtx_start = vBar.ItemsVtxStart >= 0 ? vBar.ItemsVtxStart : vDrawList->VtxBuffer.Size;
+        const int idx_start = vBar.ItemsVtxStart >= 0 ? vBar.ItemsIdxStart : vDrawList->IdxBuffer.Size;
+        const int vtx_count = vDrawList->VtxBuffer.Size - vtx_start;
+        if (vtx_count >= (1 << 16)) {
+            return false; // replayed as one 16-bit vertex range
+        }
+        for (const ImDrawCmd& cmd : vDrawList->CmdBuffer) {
+            const int idx_end = (int)(cmd.IdxOffset + cmd.ElemCount);
+            if (cmd.ElemCount == 0 || idx_end <= idx_start) {
+                continue;
+            }
+            if (cmd.UserCallback != nullptr) {
+                return false;
+            }
+            const int idx_begin = ImMax((int)cmd.IdxOffset, idx_start);
+            for (int i = idx_begin; i < idx_end; ++i) {
+                const int vtx = (int)cmd.VtxOffset + (int)vDrawList->IdxBuffer[i] - vtx_start;
+                if (vtx < 0 || vtx >= vtx_count) {
+                    return false;
+                }
+                vBar.CacheIdx.push_back((ImDrawIdx)vtx);
+            }
+            ImCoolBarCachedCmd cached;
+            cached.ClipRect = cmd.ClipRect;
+#if IMGUI_VERSION_NUM >= 19200
+            cached.Tex = cmd.TexRef;
+#else
+            cached.Tex = cmd.TextureId;
+#endif
+            cached.IdxCount = idx_end - idx_begin;
+            vBar.CacheCmds.push_back(cached);
+        }
+        vBar.CacheVtx.resize(vtx_count);
+        if (vtx_count > 0) {
+            memcpy(vBar.CacheVtx.Data, vDrawList->VtxBuffer.Data + vtx_start, (size_t)vtx_count * sizeof(ImDrawVert));
+        }
+        return true;
+    }
+
+    // Emits the retained geometry: all vertices with the first command, then each command's indices
+    // under its own clip rect and texture.
+    static void replayStaticGeometry(const ImCoolBarState& vBar, ImDrawList* vDrawList) {
+        unsigned int vtx_base = 0;
+        const ImDrawIdx* idx_ptr = vBar.CacheIdx.Data;
+        for (int n = 0; n < vBar.CacheCmds.Size; ++n) {
+            const ImCoolBarCachedCmd& cmd = vBar.CacheCmds[n];
+            vDrawList->PushClipRect(ImVec2(cmd.ClipRect.x, cmd.ClipRect.y), ImVec2(cmd.ClipRect.z, cmd.ClipRect.w));
+            pushTexture(vDrawList, cmd.Tex);
+            const int vtx_count = (n == 0) ? vBar.CacheVtx.Size : 0;
+            vDrawList->PrimReserve(cmd.IdxCount, vtx_count);
+            if (n == 0) {
+                vtx_base = vDrawList->_VtxCurrentIdx; // read after PrimReserve(), which may start a new VtxOffset
+                memcpy(vDrawList->_VtxWritePtr, vBar.CacheVtx.Data, (size_t)vtx_count * sizeof(ImDrawVert));
+                vDrawList->_VtxWritePtr += vtx_count;
+                vDrawList->_VtxCurrentIdx += (unsigned int)vtx_count;
+            }
+            for (int i = 0; i < cmd.IdxCount; ++i) {
+                vDrawList->_IdxWritePtr[i] = (ImDrawIdx)(vtx_base + idx_ptr[i]);
+            }
+            vDrawList->_IdxWritePtr += cmd.IdxCount;
+            idx_ptr += cmd.IdxCount;
+            popTexture(vDrawList);
+            vDrawList->PopClipRect();
+        }
+    }
+
+    static ImCoolBarState* getCurrentCoolBar() {
+        ImCoolBarState* bar_ptr = getOpenCoolBarContext()->CurrentBar;
+        IM_ASSERT(bar_ptr != nullptr && "CoolBar API called outside BeginCoolBar()/EndCoolBar()");
+        IM_ASSERT(bar_ptr->WindowID == ImGui::GetCurrentWindowRead()->ID && "CoolBar API called from another window");
+        return bar_ptr;
+    }
+
+    static double getTimeUs() {
+        typedef std::chrono::steady_clock Clock;
+        return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count() * 1e-3;
+    }
+
+    static int compareFloats(const void* vLhs, const void* vRhs) {
+        const float lhs = *(const float*)vLhs;
+        const float rhs = *(const float*)vRhs;
+        return (lhs > rhs) - (lhs < rhs);
+    }
+
+#ifdef IMCOOLBAR_ENABLE_TRACE
+    /// \brief One complete ("ph":"X") Chrome trace event.
+    struct TraceEvent {
+        const char*  name;    ///< Static event name.
+        double       ts_us;   ///< Start, steady_clock microseconds.
+        double       dur_us;  ///< Duration in microseconds.
+        unsigned int tid;     ///< Hashed thread id.
+        ImGuiID      bar_id;  ///< Bar window ID.
+    };
+
+    /// \brief Process-wide event buffer shared by every ImGui context and thread.
+    struct TraceCollector {
+        std::mutex                           mutex;
+        std::vector<TraceEvent>              events;
+        std::unordered_map<ImGuiID, std::string> bar_names;
+    };
+
+    static TraceCollector& getTraceCollector() {
+        static TraceCollector s_collector;
+        return s_collector;
+    }
+
+    static void traceBarName(const ImGuiID vBarID, const char* vLabel) {
+        TraceCollector& collector = getTraceCollector();
+        std::lock_guard<std::mutex> lock(collector.mutex);
+        if (collector.bar_names.find(vBarID) == collector.bar_names.end()) {
+            collector.bar_names[vBarID] = vLabel;
+        }
+    }
+
+    /// \brief Records the lifetime of a scope as a trace event.
+    class TraceScope {
+    public:
+        TraceScope(const char* vName, const ImGuiID vBarID) : m_name(vName), m_bar_id(vBarID), m_start_us(getTimeUs()) {}
+        ~TraceScope() {
+            const double end_us = getTimeUs();
+            const unsigned int tid = (unsigned int)std::hash<std::thread::id>()(std::this_thread::get_id());
+            TraceCollector& collector = getTraceCollector();
+            std::lock_guard<std::mutex> lock(collector.mutex);
+            if (collector.events.size() < (size_t)IMCOOLBAR_TRACE_MAX_EVENTS) {
+                collector.events.push_back({m_name, m_start_us, end_us - m_start_us, tid, m_bar_id});
+            }
+        }
+
+    private:
+        const char* m_name;
+        ImGuiID     m_bar_id;
+        double      m_start_us;
+    };
+
+    static void writeJsonString(FILE* vFile, const char* vText) {
+        fputc('"', vFile);
+        for (const char* p = vText; *p; ++p) {
+            const unsigned char c = (unsigned char)*p;
+            if (c == '"' || c == '\\') {
+                fputc('\\', vFile);
+                fputc(c, vFile);
+            } else if (c < 0x20) {
+                fprintf(vFile, "\\u%04x", c);
+            } else {
+                fputc(c, vFile);
+            }
+        }
+        fputc('"', vFile);
+    }
+
+#define ICB_TRACE_CONCAT_IMPL(A, B) A##B
+#define ICB_TRACE_CONCAT(A, B) ICB_TRACE_CONCAT_IMPL(A, B)
+#define ICB_TRACE_SCOPE(NAME, BAR_ID) TraceScope ICB_TRACE_CONCAT(icb_trace_scope_, __LINE__)(NAME, BAR_ID)
+#define ICB_TRACE_BAR_NAME(BAR_ID, LABEL) traceBarName(BAR_ID, LABEL)
+#else
+#define ICB_TRACE_SCOPE(NAME, BAR_ID)
+#define ICB_TRACE_BAR_NAME(BAR_ID, LABEL)
+#endif
+
+    // Min/avg/p99 of the frame-cost ring buffer
+    static void updateStatsSummary(ImCoolBarStats& vStats) {
+        const int count = vStats.frame_time_history_count;
+        if (count == 0) {
+            vStats.frame_time_min_us = vStats.frame_time_avg_us = vStats.frame_time_p99_us = 0.0f;
+            return;
+        }
+        float sorted[IMCOOLBAR_STATS_HISTORY_SIZE];
+        float sum = 0.0f;
+        for (int i = 0; i < count; ++i) {
+            sorted[i] = vStats.frame_time_history_us[i];
+            sum += sorted[i];
+        }
+        qsort(sorted, (size_t)count, sizeof(float), compareFloats);
+        vStats.frame_time_min_us = sorted[0];
+        vStats.frame_time_avg_us = sum / (float)count;
+        vStats.frame_time_p99_us = sorted[ImMin(count - 1, (int)ImCeil((float)count * 0.99f) - 1)];
+    }
+
+    /// \brief Constants shared by every lane of the bubble kernel.
+    struct BubbleParams {
+        float mouse;     ///< Filtered mouse position on the main axis.
+        float k;         ///< pi * strength / bar extent.
+        float gain;      ///< (hovered - normal) * anim scale.
+        float normal;    ///< Lower clamp.
+        float hovered;   ///< Upper clamp.
+    };
+
+    // pow(cos(x), 12) with x = v * pi * s. cos^12 has period pi, so x is reduced to
+    // [-pi/2, pi/2], cos is a degree-10 Taylor polynomial there and the power is
+    // three multiplications. Abs error vs the double-precision curve is < 4e-6 for
+    // |x| <= 4 pi and stays below the float pow(cos(x), 12) error for larger |x|.
+    static inline float bubbleEffectPoly(float x) {
+        const float pi = IM_PI;
+        const float inv_pi = 1.0f / IM_PI;
+        x -= pi * ImFloor(x * inv_pi + 0.5f);
+        const float x2 = x * x;
+        const float c  = 1.0f + x2 * (-1.0f / 2.0f + x2 * (1.0f / 24.0f + x2 * (-1.0f / 720.0f + x2 * (1.0f / 40320.0f + x2 * (-1.0f / 3628800.0f)))));
+        const float c2 = c * c;
+        const float c4 = c2 * c2;
+        return c4 * c4 * c4;
+    }
+
+    static inline float bubbleSizeScalar(const float vCenter, const BubbleParams& vParams) {
+        const float v = vParams.normal + vParams.gain * bubbleEffectPoly((vParams.mouse - vCenter) * vParams.k);
+        return ImMin(ImMax(v, vParams.normal), vParams.hovered);
+    }
+
+#if defined(ICB_SIMD_AVX)
+    static int bubbleSizesSimd(const float* vCenters, float* vOutSizes, const int vCount, const BubbleParams& vParams) {
+        const __m256 mouse   = _mm256_set1_ps(vParams.mouse);
+        const __m256 k       = _mm256_set1_ps(vParams.k);
+        const __m256 gain    = _mm256_set1_ps(vParams.gain);
+        const __m256 normal  = _mm256_set1_ps(vParams.normal);
+        const __m256 hovered = _mm256_set1_ps(vParams.hovered);
+        const __m256 pi      = _mm256_set1_ps(IM_PI);
+        const __m256 inv_pi  = _mm256_set1_ps(1.0f / IM_PI);
+        const __m256 half    = _mm256_set1_ps(0.5f);
+        const __m256 one     = _mm256_set1_ps(1.0f);
+        const __m256 p1      = _mm256_set1_ps(-1.0f / 2.0f);
+        const __m256 p2      = _mm256_set1_ps(1.0f / 24.0f);
+        const __m256 p3      = _mm256_set1_ps(-1.0f / 720.0f);
+        const __m256 p4      = _mm256_set1_ps(1.0f / 40320.0f);
+        const __m256 p5      = _mm256_set1_ps(-1.0f / 3628800.0f);
+        int i = 0;
+        for (; i + 8 <= vCount; i += 8) {
+            __m256 x = _mm256_mul_ps(_mm256_sub_ps(mouse, _mm256_loadu_ps(vCenters + i)), k);
+            x = _mm256_sub_ps(x, _mm256_mul_ps(pi, _mm256_floor_ps(_mm256_add_ps(_mm256_mul_ps(x, inv_pi), half))));
+            const __m256 x2 = _mm256_mul_ps(x, x);
+            __m256 c = _mm256_add_ps(p4, _mm256_mul_ps(x2, p5));
+            c = _mm256_add_ps(p3, _mm256_mul_ps(x2, c));
+            c = _mm256_add_ps(p2, _mm256_mul_ps(x2, c));
+            c = _mm256_add_ps(p1, _mm256_mul_ps(x2, c));
+            c = _mm256_add_ps(one, _mm256_mul_ps(x2, c));
+            const __m256 c2 = _mm256_mul_ps(c, c);
+            const __m256 c4 = _mm256_mul_ps(c2, c2);
+            const __m256 b  = _mm256_mul_ps(_mm256_mul_ps(c4, c4), c4);
+            const __m256 v  = _mm256_add_ps(normal, _mm256_mul_ps(gain, b));
+            _mm256_storeu_ps(vOutSizes + i, _mm256_min_ps(_mm256_max_ps(v, normal), hovered));
+        }
+        return i;
+    }
+#elif defined(ICB_SIMD_SSE2)
+    static int bubbleSizesSimd(const float* vCenters, float* vOutSizes, const int vCount, const BubbleParams& vParams) {
+        const __m128 mouse   = _mm_set1_ps(vParams.mouse);
+        const __m128 k       = _mm_set1_ps(vParams.k);
+        const __m128 gain    = _mm_set1_ps(vParams.gain);
+        const __m128 normal  = _mm_set1_ps(vParams.normal);
+        const __m128 hovered = _mm_set1_ps(vParams.hovered);
+        const __m128 pi      = _mm_set1_ps(IM_PI);
+        const __m128 inv_pi  = _mm_set1_ps(1.0f / IM_PI);
+        const __m128 half    = _mm_set1_ps(0.5f);
+        const __m128 one     = _mm_set1_ps(1.0f);
+        const __m128 p1      = _mm_set1_ps(-1.0f / 2.0f);
+        const __m128 p2      = _mm_set1_ps(1.0f / 24.0f);
+        const __m128 p3      = _mm_set1_ps(-1.0f / 720.0f);
+        const __m128 p4      = _mm_set1_ps(1.0f / 40320.0f);
+        const __m128 p5      = _mm_set1_ps(-1.0f / 3628800.0f);
+        int i = 0;
+        for (; i + 4 <= vCount; i += 4) {
+            __m128 x = _mm_mul_ps(_mm_sub_ps(mouse, _mm_loadu_ps(vCenters + i)), k);
+            // SSE2 has no floor: truncate, then step down where truncation rounded up
+            const __m128 r  = _mm_add_ps(_mm_mul_ps(x, inv_pi), half);
+            __m128 fl       = _mm_cvtepi32_ps(_mm_cvttps_epi32(r));
+            fl              = _mm_sub_ps(fl, _mm_and_ps(_mm_cmpgt_ps(fl, r), one));
+            x = _mm_sub_ps(x, _mm_mul_ps(pi, fl));
+            const __m128 x2 = _mm_mul_ps(x, x);
+            __m128 c = _mm_add_ps(p4, _mm_mul_ps(x2, p5));
+            c = _mm_add_ps(p3, _mm_mul_ps(x2, c));
+            c = _mm_add_ps(p2, _mm_mul_ps(x2, c));
+            c = _mm_add_ps(p1, _mm_mul_ps(x2, c));
+            c = _mm_add_ps(one, _mm_mul_ps(x2, c));
+            const __m128 c2 = _mm_mul_ps(c, c);
+            const __m128 c4 = _mm_mul_ps(c2, c2);
+            const __m128 b  = _mm_mul_ps(_mm_mul_ps(c4, c4), c4);
+            const __m128 v  = _mm_add_ps(normal, _mm_mul_ps(gain, b));
+            _mm_storeu_ps(vOutSizes + i, _mm_min_ps(_mm_max_ps(v, normal), hovered));
+        }
+        return i;
+    }
+#elif defined(ICB_SIMD_NEON)
+    static int bubbleSizesSimd(const float* vCenters, float* vOutSizes, const int vCount, const BubbleParams& vParams) {
+        const float32x4_t mouse   = vdupq_n_f32(vParams.mouse);
+        const float32x4_t k       = vdupq_n_f32(vParams.k);
+        const float32x4_t gain    = vdupq_n_f32(vParams.gain);
+        const float32x4_t normal  = vdupq_n_f32(vParams.normal);
+        const float32x4_t hovered = vdupq_n_f32(vParams.hovered);
+        const float32x4_t pi      = vdupq_n_f32(IM_PI);
+        const float32x4_t inv_pi  = vdupq_n_f32(1.0f / IM_PI);
+        const float32x4_t half    = vdupq_n_f32(0.5f);
+        const float32x4_t one     = vdupq_n_f32(1.0f);
+        const float32x4_t p1      = vdupq_n_f32(-1.0f / 2.0f);
+        const float32x4_t p2      = vdupq_n_f32(1.0f / 24.0f);
+        const float32x4_t p3      = vdupq_n_f32(-1.0f / 720.0f);
+        const float32x4_t p4      = vdupq_n_f32(1.0f / 40320.0f);
+        const float32x4_t p5      = vdupq_n_f32(-1.0f / 3628800.0f);
+        int i = 0;
+        for (; i + 4 <= vCount; i += 4) {
+            float32x4_t x = vmulq_f32(vsubq_f32(mouse, vld1q_f32(vCenters + i)), k);
+            // Truncate, then step down where truncation rounded up (floor)
+            const float32x4_t r = vaddq_f32(vmulq_f32(x, inv_pi), half);
+            float32x4_t fl      = vcvtq_f32_s32(vcvtq_s32_f32(r));
+            fl = vsubq_f32(fl, vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(fl, r), vreinterpretq_u32_f32(one))));
+            x = vsubq_f32(x, vmulq_f32(pi, fl));
+            const float32x4_t x2 = vmulq_f32(x, x);
+            float32x4_t c = vmlaq_f32(p4, x2, p5);
+            c = vmlaq_f32(p3, x2, c);
+            c = vmlaq_f32(p2, x2, c);
+            c = vmlaq_f32(p1, x2, c);
+            c = vmlaq_f32(one, x2, c);
+            const float32x4_t c2 = vmulq_f32(c, c);
+            const float32x4_t c4 = vmulq_f32(c2, c2);
+            const float32x4_t b  = vmulq_f32(vmulq_f32(c4, c4), c4);
+            const float32x4_t v  = vmlaq_f32(normal, gain, b);
+            vst1q_f32(vOutSizes + i, vminq_f32(vmaxq_f32(v, normal), hovered));
+        }
+        return i;
+    }
+#else
+    static int bubbleSizesSimd(const float*, float*, const int, const BubbleParams&) {
+        return 0;
+    }
+#endif
+
+    // SIMD lanes, then the scalar tail; vOutSizes may alias vCenters (each lane is loaded before it is stored)
+    static void bubbleSizesBatch(const float* vCenters, float* vOutSizes, const int vCount, const BubbleParams& vParams) {
+        int i = bubbleSizesSimd(vCenters, vOutSizes, vCount, vParams);
+        for (; i < vCount; ++i) {
+            vOutSizes[i] = bubbleSizeScalar(vCenters[i], vParams);
+        }
     }
 
     static bool isWindowHovered(ImGuiWindow* vWindow) {
@@ -93,25 +1108,466 @@ namespace {
         return vVec.x;
     }
 
-    static void emaReset(ImGuiID id, float value) {
-        ImGui::GetStateStorage()->SetFloat(id, value);
+    template <ImCoolBarFlags TFlags>
+    static float getChannel(const ImVec2& vVec) {
+        return (TFlags & ImCoolBarFlags_Horizontal) ? vVec.x : vVec.y;
+    }
+
+    static BubbleParams getBubbleParams(const float vMousePos, const float vBarExtent, const float vNormalSize, const float vHoveredSize, const float vEffectStrength, const float vAnimScale) {
+        BubbleParams params;
+        params.mouse   = vMousePos;
+        params.k       = IM_PI * vEffectStrength / vBarExtent;
+        params.gain    = (vHoveredSize - vNormalSize) * vAnimScale;
+        params.normal  = vNormalSize;
+        params.hovered = vHoveredSize;
+        return params;
+    }
+
+    template <bool TSnapItems>
+    static float getCrossOffset(const float vBarSize, const float vSize, const float vAnchor, const float vCrossPadding) {
+        const float offset = (vBarSize - vSize) * vAnchor + vCrossPadding;
+        return TSnapItems ? ImFloor(offset) : offset;
+    }
+
+    // Size and cross-axis offset of one item whose leading edge is at vPos.
+    // The single definition of the item layout, used by CoolBarLayout() and the item hot path.
+    template <bool TSnapItems>
+    static void layoutItem(const BubbleParams& vParams, const bool vBubble, const float vBarSize, const float vAnchor, const float vCrossPadding,
+                           const float vPos, const float vPrevSize, float& vOutSize, float& vOutOffset) {
+        vOutSize   = vBubble ? bubbleSizeScalar(vPos + vPrevSize * 0.5f, vParams) : vParams.normal;
+        vOutOffset = getCrossOffset<TSnapItems>(vBarSize, vOutSize, vAnchor, vCrossPadding);
+    }
+
+    // CoolBarItem() body with orientation and snapping fixed at compile time; the runtime
+    // CoolBarItem() dispatches to one of the four instances once per item.
+    template <ImCoolBarFlags TFlags, bool TSnapItems>
+    static bool coolBarItem(ImGuiWindow* vWindow, ImCoolBarState& vBar) {
+        if (vBar.ItemsVtxStart < 0) {
+            const ImDrawList* dl = vWindow->DrawList;
+            vBar.ItemsVtxStart = dl->VtxBuffer.Size;
+            vBar.ItemsIdxStart = dl->IdxBuffer.Size;
+        }
+        if (vBar.CacheReplaying) {
+            ++vBar.ItemIdx; // drawn by the replay in EndCoolBar()
+            return false;
+        }
+        const double item_start_us = vBar.CollectTimings ? getTimeUs() : 0.0;
+        ICB_TRACE_SCOPE("CoolBarItem", vBar.WindowID);
+        const int idx = vBar.ItemIdx;
+        if (idx >= vBar.ItemSizes.Size) {
+            vBar.ItemSizes.resize(idx + 1, 0.0f);
+        }
+        const float normal_size = vBar.NormalSize;
+        IM_ASSERT(normal_size > 0.0f);
+
+        if ((TFlags & ImCoolBarFlags_Horizontal) && idx) {
+            ImGui::SameLine();
+        }
+
+        ImGuiContext& g = *GImGui;
+        float current_size = normal_size;
+        float btn_offset   = 0.0f;
+        bool  place_item   = false;
+
+        // Filtered mouse was already updated once in BeginCoolBar(); the item is laid out where the cursor really is
+        if (vBar.AnimScale > 0.0f) {
+            if (idx < vBar.ExactSizes.Size) {
+                current_size = vBar.ExactSizes[idx]; // solved for this frame in BeginCoolBar()
+                btn_offset   = vBar.ExactOffsets[idx];
+            } else {
+                const float prev_size = vBar.ItemSizes[idx] > 0.0f ? vBar.ItemSizes[idx] : normal_size;
+                const float item_pos  = getChannel<TFlags>(vWindow->DC.CursorPos);
+                const float bar_size  = getBarSize(normal_size, vBar.HoveredSize, vBar.AnimScale);
+                const float distance  = ImFabs(item_pos + prev_size * 0.5f - vBar.LastMousePos);
+                if (distance > vBar.BubbleSupport && distance < vBar.BubbleNextLobe) {
+                    // Adaptive quality: outside the bubble's support the curve adds less than a settle epsilon
+                    btn_offset = getCrossOffset<TSnapItems>(bar_size, normal_size, vBar.Anchor, getChannel<TFlags>(g.Style.WindowPadding));
+                    ++vBar.Stats.items_culled;
+                } else {
+                    const BubbleParams params = getBubbleParams(vBar.LastMousePos, getChannel<TFlags>(vWindow->Size), normal_size, vBar.HoveredSize, vBar.EffectStrength, vBar.AnimScale);
+                    layoutItem<TSnapItems>(params, vBar.HoveredSize > normal_size, bar_size, vBar.Anchor, getChannel<TFlags>(g.Style.WindowPadding), item_pos,
+                                           prev_size, current_size, btn_offset);
+                    if (vBar.QualityLevel >= ImCoolBarQuality_Minimal) {
+                        current_size = ImFloor(current_size + 0.5f); // whole pixels: fewer size changes to redraw
+                        btn_offset   = getCrossOffset<TSnapItems>(bar_size, current_size, vBar.Anchor, getChannel<TFlags>(g.Style.WindowPadding));
+                    }
+                }
+            }
+            place_item = true;
+        }
+
+        // Item spring: the bubble size becomes the target of a critically damped spring (exact layout solved spring-free sizes)
+        if (vBar.ItemSpringOmega > 0.0f && vBar.ExactSizes.empty()) {
+            if (vBar.ItemVelocities.Size < vBar.ItemSizes.Size) {
+                vBar.ItemVelocities.resize(vBar.ItemSizes.Size, 0.0f);
+            }
+            float& velocity = vBar.ItemVelocities[idx];
+            if (vBar.ItemSizes[idx] <= 0.0f) {
+                velocity = 0.0f; // new or clipped out: starts at rest from the normal size
+            }
+            const float prev_size = vBar.ItemSizes[idx] > 0.0f ? vBar.ItemSizes[idx] : normal_size;
+            const float size = stepSpring(prev_size, velocity, current_size, vBar.ItemSpringOmega, g.IO.DeltaTime, ICB_SETTLE_EPSILON_PX);
+            vBar.ItemsSpringing |= (velocity != 0.0f);
+            if (size != current_size) {
+                current_size = size;
+                btn_offset   = getCrossOffset<TSnapItems>(getBarSize(normal_size, vBar.HoveredSize, vBar.AnimScale), size, vBar.Anchor, getChannel<TFlags>(g.Style.WindowPadding));
+                place_item   = true;
+            }
+        }
+
+        if (place_item) {
+            if (TFlags & ImCoolBarFlags_Horizontal) {
+                ImGui::SetCursorPosY(btn_offset);
+            } else {
+                ImGui::SetCursorPosX(btn_offset);
+            }
+        }
+
+        BREAK_ON_KEY(ImGuiKey_D);
+        if (ImFabs(vBar.ItemSizes[idx] - current_size) >= ICB_SETTLE_EPSILON_PX) {
+            vBar.ItemsChanged = true;
+            ++vBar.Stats.items_changed;
+        }
+        vBar.ItemIdx          = idx + 1;
+        vBar.ItemSizes[idx]   = current_size;
+        vBar.ItemCurrentSize  = current_size;
+        vBar.ItemCurrentScale = current_size / normal_size;
+        vBar.ItemCurrentPos   = vWindow->DC.CursorPos;
+
+        if (vBar.CollectTimings) {
+            vBar.Stats.items_time_us += (float)(getTimeUs() - item_start_us);
+        }
+        return true;
+    }
+
+    // Hover ramp and filtered mouse of this frame. Runs once per frame: after ImGui::Begin(), or before it
+    // with the previous frame's window in exact layout mode.
+    static void updateBarMotion(ImCoolBarContext& vCtx, ImCoolBarState& vBar, const ImCoolBarConfig& vConfig, const ImCoolBarFlags vCBFlags, ImGuiWindow* vWindow) {
+        // --- Dormant: settled last frame and the pointer is away from last frame's rect -----------------
+        // Nothing can change until the pointer comes near, the mouse filter is reseeded when it does.
+        const int frame = ImGui::GetFrameCount();
+        vBar.Dormant = vBar.WakeRectFrame == frame - 1 && vBar.WakeFrame != frame && !vBar.Animating && vBar.AnimSettled && vBar.AnimScale == 0.0f;
+        if (vBar.Dormant) {
+            vBar.Hovered            = false;
+            vBar.MouseReseedPending = true;
+            vBar.MouseRawPrevValid  = false;
+            vBar.Stats.mouse_filter_delay_ms = vBar.MouseFilterDelayMs;
+            return;
+        }
+
+        // --- Time-based smoothing for anim_scale (EMA) --------------------------------
+        {
+            ICB_TRACE_SCOPE("BeginCoolBar/AnimEMA", vBar.WindowID);
+            float anim_scale = vBar.AnimScale; // prev value (0 by default)
+
+            const bool  hovered_now = isWindowHovered(vWindow);
+            const float target      = hovered_now ? 1.0f : 0.0f;
+            vBar.Hovered = hovered_now;
+
+            // alpha = 1 - exp(-ln(2) * dt / HL)
+            float anim_alpha = 1.0f;
+            const float size_range = ImFabs(vConfig.hovered_size - vConfig.normal_size);
+            if (vBar.QualityLevel >= ImCoolBarQuality_Minimal) {
+                anim_scale        = target; // adaptive quality: no ramp under load
+                vBar.AnimVelocity = 0.0f;
+            } else if (vConfig.anim_spring_settle_ms > 0.0f) {
+                // Critically damped spring: same motion at any refresh rate, settles within 1% in anim_spring_settle_ms
+                const float omega = getSpringOmega(vConfig.anim_spring_settle_ms);
+                anim_scale = stepSpring(anim_scale, vBar.AnimVelocity, target, omega, ImGui::GetIO().DeltaTime, ICB_SETTLE_EPSILON_PX / ImMax(size_range, ICB_SETTLE_EPSILON_PX));
+                if (anim_scale < 0.0f || anim_scale > 1.0f) {
+                    vBar.AnimVelocity = 0.0f; // reversed mid-flight: stop at the end instead of overshooting
+                }
+            } else if (vConfig.anim_smoothing_ms > 0.0f) {
+                anim_alpha = getEmaAlpha(vCtx, vConfig.anim_smoothing_ms, ImGui::GetIO().DeltaTime * 1000.0f);
+
+                anim_scale += anim_alpha * (target - anim_scale);     // EMA step
+            } else {
+                // legacy step-based ramp: anim_step per frame, or a rate that does not depend on the refresh rate
+                const float step = vConfig.anim_step_per_second > 0.0f ? vConfig.anim_step_per_second * ImGui::GetIO().DeltaTime : vConfig.anim_step;
+                if (hovered_now)  anim_scale = ImMin(1.0f, anim_scale + step);
+                else              anim_scale = ImMax(0.0f, anim_scale - step);
+                vBar.AnimVelocity = 0.0f;
+            }
+            if (vConfig.anim_spring_settle_ms <= 0.0f || vBar.QualityLevel >= ImCoolBarQuality_Minimal) {
+                vBar.AnimVelocity = 0.0f;
+            }
+
+            // The EMA only approaches its target: snap once the bar size is within a sub-pixel
+            anim_scale = ImClamp(anim_scale, 0.0f, 1.0f);
+            vBar.AnimSettled = ImFabs(target - anim_scale) * size_range < ICB_SETTLE_EPSILON_PX && vBar.AnimVelocity == 0.0f;
+            if (vBar.AnimSettled) {
+                anim_scale = target;
+            }
+
+            vBar.AnimScale          = anim_scale;
+            vBar.AnimSmoothingMs    = vConfig.anim_smoothing_ms;
+            vBar.AnimSmoothingAlpha = anim_alpha;
+        }
+        
+        // --- Time-based smoothing setup for mouse (compute per-frame alpha, EMA) ------------------------
+        {
+            ICB_TRACE_SCOPE("BeginCoolBar/MouseAlpha", vBar.WindowID);
+            ImGuiIO& io = ImGui::GetIO();
+            vBar.MouseSmoothingMs = vConfig.mouse_smoothing_ms;
+
+            const ImCoolBarMouseFilter filter = vBar.QualityLevel >= ImCoolBarQuality_Reduced ? ImCoolBarMouseFilter_Ema : vConfig.mouse_filter;
+            if (filter != vBar.MouseFilter) {
+                vBar.MouseReseedPending = true; // the other filter's state is stale
+            }
+            vBar.MouseFilter = filter;
+            float alpha = 1.0f; // disabled by default -> pass-through
+            if (vBar.MouseFilter == ImCoolBarMouseFilter_Ema && vConfig.mouse_smoothing_ms > 0.0f) {
+                alpha = getEmaAlpha(vCtx, vConfig.mouse_smoothing_ms, ImMin(io.DeltaTime * 1000.0f, 100.0f));
+            }
+            vBar.MouseSmoothingAlpha = alpha;
+
+            // NOTE: do NOT reset EMA on leave — we want continuity across hover boundaries.
+            if (io.AppFocusLost || !ImGui::IsMousePosValid()) {
+                vBar.MouseSmoothingInit = false;
+                vBar.MouseReseedPending = true;
+                vBar.MouseRawPrevValid  = false;
+            }
+        }
+        
+        // --- Update filtered mouse (once per frame), independent of hover ------
+        if (ImGui::IsMousePosValid()) {
+            ICB_TRACE_SCOPE("BeginCoolBar/MouseFilter", vBar.WindowID);
+            const float m_raw = getChannel(ImGui::GetMousePos(), vCBFlags);
+            const float dt    = ImClamp(ImGui::GetIO().DeltaTime, 1e-4f, 0.1f);
+            float m_flt = m_raw;
+            const bool need_seed = !vBar.MouseSmoothingInit || vBar.MouseReseedPending;
+            if (vBar.MouseFilter != ImCoolBarMouseFilter_Ema) {
+                m_flt = filterMouseOneEuro(vBar, vConfig, m_raw, dt, need_seed);
+            } else if (vBar.MouseSmoothingMs > 0.0f && vBar.MouseSmoothingAlpha > 0.0f) {
+                if (need_seed) {
+                    vBar.MouseSmoothing     = m_raw;          // seed once on first valid
+                    vBar.MouseSmoothingInit = true;
+                    vBar.MouseReseedPending = false;
+                } else {
+                    vBar.MouseSmoothing += vBar.MouseSmoothingAlpha * (m_raw - vBar.MouseSmoothing); // EMA step
+                    if (ImFabs(m_raw - vBar.MouseSmoothing) < ICB_SETTLE_EPSILON_PX) {
+                        vBar.MouseSmoothing = m_raw;
+                    }
+                    m_flt = vBar.MouseSmoothing;
+                }
+            }
+            // Filter delay = how long ago the raw mouse was where the filtered one is now, while moving
+            if (vBar.MouseRawPrevValid) {
+                const float raw_speed = (m_raw - vBar.MouseRawPrev) / dt;
+                if (ImFabs(raw_speed) > 50.0f) {
+                    const float delay_ms = ImClamp((m_raw - m_flt) / raw_speed * 1000.0f, -250.0f, 250.0f);
+                    vBar.MouseFilterDelayMs += 0.1f * (delay_ms - vBar.MouseFilterDelayMs);
+                }
+            }
+            vBar.MouseRawPrev      = m_raw;
+            vBar.MouseRawPrevValid = true;
+            vBar.MouseSettled = (m_flt == m_raw);
+            vBar.LastMousePos = m_flt;
+        }
+        vBar.Stats.mouse_filter_delay_ms = vBar.MouseFilterDelayMs;
+    }
+
+    // Exact layout: this frame's item sizes and bar rect, solved before ImGui::Begin() so the window is placed and
+    // sized for the current mouse. Item centers use their own new size (fixed point, refined block by block through the
+    // batch kernel), and the bar extent, which moves the window and thus the items under the mouse, is iterated until it
+    // changes by less than a sub-pixel.
+    static void solveExactLayout(ImCoolBarState& vBar, const ImCoolBarConfig& vConfig, const ImGuiWindow* vWindow, const int vItemsCount) {
+        ImGuiContext& g = *GImGui;
+        const ImCoolBarFlags flags = vBar.Flags;
+        if (vBar.ItemSizes.Size < vItemsCount) {
+            vBar.ItemSizes.resize(vItemsCount, 0.0f);
+        }
+        vBar.ExactSizes.resize(vItemsCount);
+        vBar.ExactOffsets.resize(vItemsCount);
+
+        const ImGuiViewport* vp = vWindow->Viewport != nullptr ? vWindow->Viewport : ImGui::GetMainViewport();
+        const ImVec2 pad = g.Style.WindowPadding;
+        ImCoolBarLayoutInput input;
+        input.items_count          = vItemsCount;
+        input.prev_sizes           = vBar.ItemSizes.Data;
+        input.item_spacing         = getChannel(g.Style.ItemSpacing, flags);
+        input.mouse_pos            = vBar.LastMousePos;
+        input.anim_scale           = vBar.AnimScale;
+        input.normal_size          = vBar.NormalSize;
+        input.hovered_size         = vBar.HoveredSize;
+        input.effect_strength      = vBar.EffectStrength;
+        input.anchor               = vBar.Anchor;
+        input.cross_padding        = getChannel(pad, flags);
+        input.snap_items_to_pixels = vBar.SnapItemsToPixels;
+        input.center_iterations    = ICB_EXACT_LAYOUT_PASSES;
+        ImCoolBarLayoutOutput output;
+        output.sizes         = vBar.ExactSizes.Data;
+        output.cross_offsets = vBar.ExactOffsets.Data;
+
+        const float cross = getBarSize(vBar.NormalSize, vBar.HoveredSize, vBar.AnimScale) + getChannelInv(pad, flags) * 2.0f;
+        float  extent = getChannel(vWindow->ContentSize, flags); // last frame's: a close first guess
+        ImVec2 bar_size, new_pos;
+        for (int iter = 0; iter < 4; ++iter) {
+            const float main = extent + getChannel(pad, flags) * 2.0f;
+            bar_size = ImMin((flags & ImCoolBarFlags_Horizontal) ? ImVec2(main, cross) : ImVec2(cross, main), vp->Size);
+            new_pos  = vp->Pos + (vp->Size - bar_size) * vConfig.anchor;
+            if (vConfig.snap_window_to_pixels) {
+                new_pos.x = ImFloor(new_pos.x);
+                new_pos.y = ImFloor(new_pos.y);
+            }
+            input.start_pos  = getChannel(new_pos, flags) + getChannel(pad, flags) - getChannel(vWindow->Scroll, flags);
+            input.bar_extent = getChannel(bar_size, flags);
+            ImGui::CoolBarLayout(input, output);
+            const bool converged = ImFabs(output.main_extent - extent) < ICB_SETTLE_EPSILON_PX;
+            extent = output.main_extent;
+            if (converged) {
+                break;
+            }
+        }
+        const float main = extent + getChannel(pad, flags) * 2.0f;
+        ImGui::SetNextWindowPos(new_pos);
+        ImGui::SetNextWindowSize(ImMin((flags & ImCoolBarFlags_Horizontal) ? ImVec2(main, cross) : ImVec2(cross, main), vp->Size));
     }
 
-    static float emaUpdate(ImGuiID id, float sample, float alpha) {
-        ImGuiStorage* st = ImGui::GetStateStorage();
-        float current = st->GetFloat(id, sample);
-        current += alpha * (sample - current);
-        st->SetFloat(id, current);
-        return current;
+    // Per-frame bar parameters from the config
+    // Steps the quality down while the averaged DeltaTime stays over frame_budget_ms, and back up once it stays
+    // under 85% of it. Runs once per frame even when the exact layout sets the bar up before Begin().
+    static void updateQualityGovernor(ImCoolBarState& vBar, const ImCoolBarConfig& vConfig) {
+        const int frame = ImGui::GetFrameCount();
+        if (vBar.QualityFrame == frame) {
+            return;
+        }
+        vBar.QualityFrame = frame;
+        if (!vConfig.adaptive_quality || vConfig.frame_budget_ms <= 0.0f) {
+            vBar.QualityLevel   = ImCoolBarQuality_Full;
+            vBar.QualityFrameMs = 0.0f;
+            vBar.QualityTimer   = 0.0f;
+            return;
+        }
+        const float dt    = ImGui::GetIO().DeltaTime;
+        const float dt_ms = dt * 1000.0f;
+        if (vBar.QualityFrameMs <= 0.0f) {
+            vBar.QualityFrameMs = dt_ms;
+        } else {
+            vBar.QualityFrameMs += (1.0f - expf(-0.69314718056f * dt_ms / ICB_QUALITY_AVG_MS)) * (dt_ms - vBar.QualityFrameMs);
+        }
+        if (vBar.QualityFrameMs > vConfig.frame_budget_ms) {
+            vBar.QualityTimer = ImMax(vBar.QualityTimer, 0.0f) + dt;
+            if (vBar.QualityTimer >= ICB_QUALITY_DOWN_S && vBar.QualityLevel < ImCoolBarQuality_Minimal) {
+                ++vBar.QualityLevel;
+                vBar.QualityTimer = 0.0f;
+            }
+        } else if (vBar.QualityFrameMs < vConfig.frame_budget_ms * 0.85f) {
+            vBar.QualityTimer = ImMin(vBar.QualityTimer, 0.0f) - dt;
+            if (vBar.QualityTimer <= -ICB_QUALITY_UP_S && vBar.QualityLevel > ImCoolBarQuality_Full) {
+                --vBar.QualityLevel;
+                vBar.QualityTimer = 0.0f;
+            }
+        } else {
+            vBar.QualityTimer = 0.0f;
+        }
     }
 
-    //static float emaValue(ImGuiID id, float default_value) {
-    //    return ImGui::GetStateStorage()->GetFloat(id, default_value);
-    //}
+    static void setupBar(ImCoolBarState& vBar, const ImCoolBarFlags vCBFlags, const ImCoolBarConfig& vConfig) {
+        updateQualityGovernor(vBar, vConfig);
+        vBar.Flags              = vCBFlags;
+        vBar.Anchor             = ImClamp(getChannelInv(vConfig.anchor, vCBFlags), 0.0f, 1.0f);
+        vBar.NormalSize         = vConfig.normal_size;
+        vBar.HoveredSize        = vConfig.hovered_size;
+        vBar.EffectStrength     = vConfig.effect_strength;
+        vBar.SnapItemsToPixels  = vConfig.snap_items_to_pixels;
+        vBar.SnapWindowToPixels = vConfig.snap_window_to_pixels;
+        vBar.ItemSpringOmega    = vBar.QualityLevel >= ImCoolBarQuality_Reduced ? 0.0f : getSpringOmega(vConfig.item_spring_settle_ms);
+    }
 
 }; // namespace
 
+IMGUI_API void ImGui::CoolBarBubbleSizes(const float* vCenters, float* vOutSizes, int vCount, float vMousePos, float vBarExtent, float vNormalSize, float vHoveredSize, float vEffectStrength, float vAnimScale) {
+    IM_ASSERT(vCount >= 0 && (vCount == 0 || (vCenters != nullptr && vOutSizes != nullptr)));
+    IM_ASSERT(vBarExtent > 0.0f);
+    if (vHoveredSize <= vNormalSize || vAnimScale <= 0.0f) {
+        // Degenerate config or no hover: every item keeps its normal size
+        for (int i = 0; i < vCount; ++i) {
+            vOutSizes[i] = vNormalSize;
+        }
+        return;
+    }
+    const BubbleParams params = getBubbleParams(vMousePos, vBarExtent, vNormalSize, vHoveredSize, vEffectStrength, vAnimScale);
+    bubbleSizesBatch(vCenters, vOutSizes, vCount, params);
+}
+
+IMGUI_API void ImGui::CoolBarLayout(const ImCoolBarLayoutInput& vInput, ImCoolBarLayoutOutput& vOutput) {
+    IM_ASSERT(vInput.items_count >= 0 && (vInput.items_count == 0 || vOutput.sizes != nullptr));
+    IM_ASSERT(vInput.normal_size > 0.0f && vInput.bar_extent > 0.0f);
+    const float normal_size = vInput.normal_size;
+    const bool  bubble      = vInput.hovered_size > normal_size && vInput.anim_scale > 0.0f;
+    const BubbleParams params = getBubbleParams(vInput.mouse_pos, vInput.bar_extent, normal_size, vInput.hovered_size, vInput.effect_strength, vInput.anim_scale);
+    const float bar_size = getBarSize(normal_size, vInput.hovered_size, vInput.anim_scale);
+
+    // Refined layout: blocks of ICB_LAYOUT_BLOCK items are placed one after another, each where the previous block
+    // ended with its new sizes. Inside a block, all centers are moved to the current sizes and evaluated in one batch
+    // of the kernel, until no size moves by more than ICB_LAYOUT_EPSILON_PX or center_iterations passes ran.
+    if (vInput.center_iterations > 0) {
+        float pos = vInput.start_pos;
+        for (int block = 0; block < vInput.items_count; block += ICB_LAYOUT_BLOCK) {
+            const int count = ImMin(vInput.items_count - block, ICB_LAYOUT_BLOCK);
+            float* sizes = vOutput.sizes + block;
+            for (int i = 0; i < count; ++i) {
+                const float prev_size = vInput.prev_sizes != nullptr ? vInput.prev_sizes[block + i] : 0.0f;
+                sizes[i] = prev_size > 0.0f ? prev_size : normal_size;
+            }
+            for (int pass = 0; bubble && pass < vInput.center_iterations; ++pass) {
+                float centers[ICB_LAYOUT_BLOCK];
+                float item_pos = pos;
+                for (int i = 0; i < count; ++i) {
+                    centers[i] = item_pos + sizes[i] * 0.5f;
+                    item_pos += sizes[i] + vInput.item_spacing;
+                }
+                float new_sizes[ICB_LAYOUT_BLOCK];
+                bubbleSizesBatch(centers, new_sizes, count, params);
+                float moved = 0.0f;
+                for (int i = 0; i < count; ++i) {
+                    moved    = ImMax(moved, ImFabs(new_sizes[i] - sizes[i]));
+                    sizes[i] = new_sizes[i];
+                }
+                if (moved <= ICB_LAYOUT_EPSILON_PX) {
+                    break;
+                }
+            }
+            for (int i = 0; i < count; ++i) {
+                if (!bubble) {
+                    sizes[i] = normal_size;
+                }
+                if (vOutput.cross_offsets != nullptr) {
+                    vOutput.cross_offsets[block + i] = vInput.snap_items_to_pixels ? getCrossOffset<true>(bar_size, sizes[i], vInput.anchor, vInput.cross_padding)
+                                                                                   : getCrossOffset<false>(bar_size, sizes[i], vInput.anchor, vInput.cross_padding);
+                }
+                pos += sizes[i] + vInput.item_spacing;
+            }
+        }
+        vOutput.bar_size    = bar_size;
+        vOutput.main_extent = vInput.items_count > 0 ? pos - vInput.start_pos - vInput.item_spacing : 0.0f;
+        return;
+    }
+
+    // Sequential: each item starts where the previous one ended with its new size
+    float pos = vInput.start_pos;
+    for (int i = 0; i < vInput.items_count; ++i) {
+        const float prev_size = (vInput.prev_sizes != nullptr && vInput.prev_sizes[i] > 0.0f) ? vInput.prev_sizes[i] : normal_size;
+        float size = normal_size, offset = 0.0f;
+        if (vInput.snap_items_to_pixels) {
+            layoutItem<true>(params, bubble, bar_size, vInput.anchor, vInput.cross_padding, pos, prev_size, size, offset);
+        } else {
+            layoutItem<false>(params, bubble, bar_size, vInput.anchor, vInput.cross_padding, pos, prev_size, size, offset);
+        }
+        vOutput.sizes[i] = size;
+        if (vOutput.cross_offsets != nullptr) {
+            vOutput.cross_offsets[i] = offset;
+        }
+        pos += size + vInput.item_spacing;
+    }
+    vOutput.bar_size    = bar_size;
+    vOutput.main_extent = vInput.items_count > 0 ? pos - vInput.start_pos - vInput.item_spacing : 0.0f;
+}
+
 IMGUI_API bool ImGui::BeginCoolBar(const char* vLabel, ImCoolBarFlags vCBFlags, const ImCoolBarConfig& vConfig, ImGuiWindowFlags vFlags) {
+    const double begin_start_us = vConfig.collect_timings ? getTimeUs() : 0.0;
+    ICB_TRACE_SCOPE("BeginCoolBar", ImHashStr(vLabel));
     ImGuiWindowFlags flags =                   //
         vFlags |                               //
         ImGuiWindowFlags_NoTitleBar |          //
@@ -125,6 +1581,30 @@ IMGUI_API bool ImGui::BeginCoolBar(const char* vLabel, ImCoolBarFlags vCBFlags,
 #       endif                                  //
         ImGuiWindowFlags_NoFocusOnAppearing |  //
         ICB_DOCKING_HOST_FLAGS;                //
+
+    ImCoolBarContext* ctx_ptr = getCoolBarContext();
+    int storage_lookups = 1; // context hook scan
+    pruneCoolBars(*ctx_ptr);
+    updatePointerService(*ctx_ptr);
+    const int next_items_count = ctx_ptr->NextItemsCount;
+    ctx_ptr->NextItemsCount = -1;
+
+    // --- Exact layout: motion, item sizes and window rect of THIS frame, before Begin() ---
+    bool exact_layout = false;
+    if (vConfig.exact_layout) {
+        const ImGuiID id = ImHashStr(vLabel);
+        ImCoolBarState* bar_ptr = ctx_ptr->Bars.GetByKey(id);
+        ImGuiWindow* prev_window_ptr = ImGui::FindWindowByID(id);
+        storage_lookups += 2;
+        if (bar_ptr != nullptr && prev_window_ptr != nullptr) { // first frame: regular path
+            ICB_TRACE_SCOPE("BeginCoolBar/ExactLayout", id);
+            setupBar(*bar_ptr, vCBFlags, vConfig);
+            updateBarMotion(*ctx_ptr, *bar_ptr, vConfig, vCBFlags, prev_window_ptr);
+            solveExactLayout(*bar_ptr, vConfig, prev_window_ptr, next_items_count >= 0 ? next_items_count : bar_ptr->ItemSizes.Size);
+            exact_layout = true;
+        }
+    }
+
     bool res = ImGui::Begin(vLabel, nullptr, flags);
     if (!res) {
         ImGui::End();
@@ -135,156 +1615,139 @@ IMGUI_API bool ImGui::BeginCoolBar(const char* vLabel, ImCoolBarFlags vCBFlags,
             ((vCBFlags & ImCoolBarFlags_Vertical) == ImCoolBarFlags_Vertical)         //
         );
 
-        ImGuiContext& g = *GImGui;
         ImGuiWindow* window_ptr = GetCurrentWindow();
 
-        // --- Force local AA for this bar (and remember previous flags) ---
+        // --- Resolve the bar state once; items index into it directly ---
+        ImCoolBarState* bar_ptr = ctx_ptr->Bars.GetByKey(window_ptr->ID);
+        ++storage_lookups;
+        if (bar_ptr == nullptr) {
+            bar_ptr = ctx_ptr->Bars.GetOrAddByKey(window_ptr->ID);
+            ++storage_lookups;
+            ctx_ptr->Registry.push_back(ctx_ptr->Bars.GetIndex(bar_ptr));
+        }
+        ctx_ptr->BarStack.push_back(ctx_ptr->Bars.GetIndex(bar_ptr));
+        ctx_ptr->CurrentBar = bar_ptr;
+        s_open_owner_ptr    = GImGui;
+        s_open_ctx_ptr      = ctx_ptr;
+        ImCoolBarState& bar = *bar_ptr;
+        bar.WindowID        = window_ptr->ID;
+        bar.LastActiveFrame = ImGui::GetFrameCount();
+        bar.LastActiveTime  = ImGui::GetTime();
+        bar.ItemsChanged    = false;
+        bar.ItemsSpringing  = false;
+        bar.CollectTimings  = vConfig.collect_timings;
+        ICB_TRACE_BAR_NAME(bar.WindowID, vLabel);
+
+        ImCoolBarStats& stats = bar.Stats;
+        stats.frame           = bar.LastActiveFrame;
+        stats.items_count     = 0;
+        stats.items_changed   = 0;
+        stats.storage_lookups = storage_lookups; // labels add theirs
+        stats.items_time_us   = 0.0f;
+        stats.labels_count    = 0;
+        stats.labels_measured = 0;
+
+        bar.ItemIdx = 0;
+        setupBar(bar, vCBFlags, vConfig);
+        stats.quality_level    = bar.QualityLevel;
+        stats.quality_frame_ms = bar.QualityFrameMs;
+        stats.items_culled     = 0;
+
+        // --- Force local AA for this bar (and remember previous flags); the quality governor drops it under load ---
         {
             ImDrawList* dl = ImGui::GetWindowDrawList();
-
-            const ImGuiID dl_flags_id     = window_ptr->GetID(ICB_PREFIX "PrevDLFlags");
-            const ImGuiID dl_flags_set_id = window_ptr->GetID(ICB_PREFIX "PrevDLFlagsSet");
-            const ImGuiID pushed_round_id = window_ptr->GetID(ICB_PREFIX "PushedRounding");
-            
-            
-            if (vConfig.local_antialiasing) {
-                window_ptr->StateStorage.SetInt (dl_flags_id, (int)dl->Flags);
-                window_ptr->StateStorage.SetBool(dl_flags_set_id, true);
+            if (vConfig.local_antialiasing && bar.QualityLevel < ImCoolBarQuality_NoAA) {
+                bar.PrevDLFlags    = dl->Flags;
+                bar.PrevDLFlagsSet = true;
                 dl->Flags |= ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AntiAliasedLines;
 
                 if (vConfig.frame_rounding_override >= 0.0f) {
                     ImGui::PushStyleVar(ImGuiStyleVar_FrameRounding, vConfig.frame_rounding_override);
-                    window_ptr->StateStorage.SetBool(pushed_round_id, true);
+                    bar.PushedRounding = true;
                 } else {
-                    window_ptr->StateStorage.SetBool(pushed_round_id, false);
+                    bar.PushedRounding = false;
                 }
             } else {
                 // Ensure EndCoolBar has no state to restore
-                window_ptr->StateStorage.SetBool(dl_flags_set_id, false);
-                window_ptr->StateStorage.SetBool(pushed_round_id, false);
+                bar.PrevDLFlagsSet = false;
+                bar.PushedRounding = false;
             }
-            
-            window_ptr->StateStorage.SetBool(window_ptr->GetID(ICB_PREFIX "SnapItemsToPixels"),  vConfig.snap_items_to_pixels);
-            window_ptr->StateStorage.SetBool(window_ptr->GetID(ICB_PREFIX "SnapWindowToPixels"), vConfig.snap_window_to_pixels);
         }
 
-        window_ptr->StateStorage.SetVoidPtr(window_ptr->GetID(ICB_PREFIX "Type"), (void*)"ImCoolBar");
-        window_ptr->StateStorage.SetInt(window_ptr->GetID(ICB_PREFIX "ItemIdx"), 0);
-        window_ptr->StateStorage.SetInt(window_ptr->GetID(ICB_PREFIX "Flags"), vCBFlags);
-
-        const float anchor = ImClamp(getChannelInv(vConfig.anchor, vCBFlags), 0.0f, 1.0f);
-        window_ptr->StateStorage.SetFloat(window_ptr->GetID(ICB_PREFIX "Anchor"), anchor);
-
-        window_ptr->StateStorage.SetFloat(window_ptr->GetID(ICB_PREFIX "NormalSize"), vConfig.normal_size);
-        window_ptr->StateStorage.SetFloat(window_ptr->GetID(ICB_PREFIX "HoveredSize"), vConfig.hovered_size);
-        window_ptr->StateStorage.SetFloat(window_ptr->GetID(ICB_PREFIX "EffectStrength"), vConfig.effect_strength);
-
-        // --- Time-based smoothing for anim_scale (EMA) --------------------------------
-        float anim_scale = 0.0;
-        {
-            const ImGuiID anim_scale_id = window_ptr->GetID(ICB_PREFIX "AnimScale");
-            anim_scale = window_ptr->StateStorage.GetFloat(anim_scale_id); // prev value (0 by default)
-
-            const bool  hovered_now = isWindowHovered(window_ptr);
-            const float target      = hovered_now ? 1.0f : 0.0f;
-
-            // alpha = 1 - exp(-ln(2) * dt / HL)
-            float anim_alpha = 1.0f;
-            if (vConfig.anim_smoothing_ms > 0.0f) {
-                const float dt_ms = ImGui::GetIO().DeltaTime * 1000.0f;
-                const float k     = 0.69314718056f; // ln(2)
-                anim_alpha = 1.0f - expf(-k * (dt_ms / vConfig.anim_smoothing_ms));
-                anim_alpha = ImClamp(anim_alpha, 0.0f, 1.0f);
+        if (!exact_layout) {
+            updateBarMotion(*ctx_ptr, bar, vConfig, vCBFlags, window_ptr);
+            bar.ExactSizes.resize(0);
+            bar.ExactOffsets.resize(0);
+        }
+        bar.BubbleSupport  = FLT_MAX;
+        bar.BubbleNextLobe = FLT_MAX;
+        if (vConfig.adaptive_quality) {
+            getBubbleSupport(bar.NormalSize, bar.HoveredSize, bar.EffectStrength, getChannel(window_ptr->Size, vCBFlags), bar.BubbleSupport, bar.BubbleNextLobe);
+        }
 
-                anim_scale += anim_alpha * (target - anim_scale);     // EMA step
+        // --- Position with predicted cross-axis size for THIS frame (exact layout placed it before Begin()) ---
+        if (!exact_layout) {
+            ICB_TRACE_SCOPE("BeginCoolBar/WindowPos", bar.WindowID);
+            ImVec2 pad = ImGui::GetStyle().WindowPadding * 2.0f;
+            ImVec2 bar_size = window_ptr->ContentSize + pad; // along main axis ok
+            const float cross = getBarSize(bar.NormalSize, bar.HoveredSize, bar.AnimScale);
+            if (vCBFlags & ImCoolBarFlags_Horizontal) {
+                bar_size.y = cross + pad.y;
             } else {
-                // legacy step-based ramp
-                if (hovered_now)  anim_scale = ImMin(1.0f, anim_scale + vConfig.anim_step);
-                else              anim_scale = ImMax(0.0f, anim_scale - vConfig.anim_step);
+                bar_size.x = cross + pad.x;
             }
-
-            anim_scale = ImClamp(anim_scale, 0.0f, 1.0f);
-            window_ptr->StateStorage.SetFloat(anim_scale_id, anim_scale);
-
-            window_ptr->StateStorage.SetFloat(window_ptr->GetID(ICB_PREFIX "AnimSmoothingMs"), vConfig.anim_smoothing_ms);
-            window_ptr->StateStorage.SetFloat(window_ptr->GetID(ICB_PREFIX "AnimSmoothingAlpha"),      anim_alpha);
-        }
-        
-        // --- Time-based smoothing setup for mouse (compute per-frame alpha, EMA) ------------------------
-        {
-            ImGuiIO& io = ImGui::GetIO();
-            const ImGuiID ema_hl_id    = window_ptr->GetID(ICB_PREFIX "MouseSmoothingMs");
-            const ImGuiID ema_alpha_id = window_ptr->GetID(ICB_PREFIX "MouseSmoothingAlpha");
-            const ImGuiID ema_init_id  = window_ptr->GetID(ICB_PREFIX "MouseSmoothingInit");
-            const ImGuiID reseed_id    = window_ptr->GetID(ICB_PREFIX "MouseReseedPending");
-
-            window_ptr->StateStorage.SetFloat(ema_hl_id, vConfig.mouse_smoothing_ms);
-
-            float alpha = 1.0f; // disabled by default -> pass-through
-            if (vConfig.mouse_smoothing_ms > 0.0f) {
-                // alpha = 1 - exp(-ln(2) * dt / HL)
-                float dt_ms = ImGui::GetIO().DeltaTime * 1000.0f;
-                dt_ms = ImMin(dt_ms, 100.0f);
-                const float k     = 0.69314718056f; // ln(2)
-                alpha = 1.0f - expf(-k * (dt_ms / vConfig.mouse_smoothing_ms));
-                alpha = ImClamp(alpha, 0.0f, 1.0f);
+            const ImGuiViewport* vp = window_ptr->Viewport;
+            bar_size = ImMin(bar_size, vp->Size); // long (clipped) bars scroll inside the viewport
+            ImVec2 new_pos = vp->Pos + (vp->Size - bar_size) * vConfig.anchor;
+            if (vConfig.snap_window_to_pixels) {
+                new_pos.x = ImFloor(new_pos.x);
+                new_pos.y = ImFloor(new_pos.y);
             }
-            window_ptr->StateStorage.SetFloat(ema_alpha_id, alpha);
-
-            // NOTE: do NOT reset EMA on leave — we want continuity across hover boundaries.
-            if (io.AppFocusLost || !ImGui::IsMousePosValid())
-                window_ptr->StateStorage.SetBool(ema_init_id, false), window_ptr->StateStorage.SetBool(reseed_id, true);
+            ImGui::SetWindowPos(new_pos);
         }
-        
-        // --- Update filtered mouse (once per frame), independent of hover ------
-        {
-            const ImGuiID ema_id      = window_ptr->GetID(ICB_PREFIX "MouseSmoothing");
-            const ImGuiID ema_init_id = window_ptr->GetID(ICB_PREFIX "MouseSmoothingInit");
-            const ImGuiID reseed_id   = window_ptr->GetID(ICB_PREFIX "MouseReseedPending");
-            const ImGuiID last_m_id   = window_ptr->GetID(ICB_PREFIX "LastMousePos");
-            const float   alpha       = window_ptr->StateStorage.GetFloat(window_ptr->GetID(ICB_PREFIX "MouseSmoothingAlpha"));
-            const float   hl_ms       = window_ptr->StateStorage.GetFloat(window_ptr->GetID(ICB_PREFIX "MouseSmoothingMs"));
-
-            if (ImGui::IsMousePosValid()) {
-                float m_raw = getChannel(ImGui::GetMousePos(), vCBFlags);
-                float m_flt = m_raw;
-                const bool need_seed = !window_ptr->StateStorage.GetBool(ema_init_id) ||
-                                        window_ptr->StateStorage.GetBool(reseed_id);
-                if (hl_ms > 0.0f && alpha > 0.0f) {
-                    if (need_seed) {
-                        emaReset(ema_id, m_raw);                 // seed once on first valid
-                        window_ptr->StateStorage.SetBool(ema_init_id, true);
-                        window_ptr->StateStorage.SetBool(reseed_id, false);
-                    } else {
-                        m_flt = emaUpdate(ema_id, m_raw, alpha); // EMA step
-                    }
+
+        // --- Static frame: replay the retained geometry, or retain this frame's ---
+        if (vConfig.cache_static_geometry) {
+            // bar.Animating is still the previous frame's: a frame is static once the last one settled
+            const bool static_frame = !bar.Hovered && bar.AnimScale == 0.0f && bar.AnimSettled && !bar.Animating && !bar.CacheUnsafe;
+            if (static_frame) {
+                const ImGuiID key = getStaticFrameKey(bar, vConfig, window_ptr);
+                if (key != bar.CacheKey) {
+                    bar.CacheValid = false;
                 }
-                window_ptr->StateStorage.SetFloat(last_m_id, m_flt);
+                bar.CacheKey = key;
+            } else {
+                bar.CacheValid = false;
             }
-        }
-
-        // --- Position with predicted cross-axis size for THIS frame ---
-        ImVec2 pad = ImGui::GetStyle().WindowPadding * 2.0f;
-        ImVec2 bar_size = window_ptr->ContentSize + pad; // along main axis ok
-        const float normal_size  = window_ptr->StateStorage.GetFloat(window_ptr->GetID(ICB_PREFIX "NormalSize"));
-        const float hovered_size = window_ptr->StateStorage.GetFloat(window_ptr->GetID(ICB_PREFIX "HoveredSize"));
-        const float cross = getBarSize(normal_size, hovered_size, anim_scale);
-        if (vCBFlags & ImCoolBarFlags_Horizontal) {
-            bar_size.y = cross + pad.y;
+            bar.CacheReplaying = static_frame && bar.CacheValid;
+            bar.CacheCapturing = static_frame && !bar.CacheValid;
         } else {
-            bar_size.x = cross + pad.x;
-        }
-        const ImGuiViewport* vp = window_ptr->Viewport;
-        ImVec2 new_pos = vp->Pos + (vp->Size - bar_size) * vConfig.anchor;
-        if (vConfig.snap_window_to_pixels) {
-            new_pos.x = ImFloor(new_pos.x);
-            new_pos.y = ImFloor(new_pos.y);
+            if (!bar.CacheVtx.empty()) {
+                bar.CacheVtx.clear();
+                bar.CacheIdx.clear();
+                bar.CacheCmds.clear();
+            }
+            bar.CacheValid     = false;
+            bar.CacheReplaying = false;
+            bar.CacheCapturing = false;
         }
-        ImGui::SetWindowPos(new_pos);
-        
-        window_ptr->StateStorage.SetBool(window_ptr->GetID(ICB_PREFIX "SnapItemsToPixels"),
-                                         vConfig.snap_items_to_pixels);
+        stats.replayed = bar.CacheReplaying;
+        stats.dormant  = bar.Dormant;
+
+        // One hit test per bar: only a click inside the bar is matched against icon rects
+        bar.IconClickPending = ImGui::IsWindowHovered() && ImGui::IsMouseClicked(ImGuiMouseButton_Left);
+        bar.IconQuads.resize(0);
+        bar.IconQuadsPeak = 0;
+        bar.PendingLabels.resize(0);
+        bar.PendingLabelText.resize(0);
 
+        ImDrawList* dl = ImGui::GetWindowDrawList();
+        bar.StatsVtxStart = dl->VtxBuffer.Size;
+        bar.StatsIdxStart = dl->IdxBuffer.Size;
+        bar.ItemsVtxStart = -1;
+        if (bar.CollectTimings) {
+            stats.begin_time_us = (float)(getTimeUs() - begin_start_us);
+        }
     }
     return res;
 }
@@ -293,17 +1756,93 @@ IMGUI_API void ImGui::EndCoolBar() {
     // Restore AA flags and rounding we pushed in BeginCoolBar()
     ImGuiWindow* window_ptr = GetCurrentWindow();
     if (window_ptr) {
+        ImCoolBarContext* ctx_ptr = getOpenCoolBarContext();
+        ImCoolBarState& bar = *getCurrentCoolBar();
+        const double end_start_us = bar.CollectTimings ? getTimeUs() : 0.0;
+        ICB_TRACE_SCOPE("EndCoolBar", bar.WindowID);
         ImDrawList* dl = ImGui::GetWindowDrawList();
-        const ImGuiID dl_flags_set_id = window_ptr->GetID(ICB_PREFIX "PrevDLFlagsSet");
-        if (window_ptr->StateStorage.GetBool(dl_flags_set_id)) {
-            const ImGuiID dl_flags_id = window_ptr->GetID(ICB_PREFIX "PrevDLFlags");
-            dl->Flags = (ImDrawListFlags)window_ptr->StateStorage.GetInt(dl_flags_id);
-            window_ptr->StateStorage.SetBool(dl_flags_set_id, false);
-        }
-        const ImGuiID pushed_round_id = window_ptr->GetID(ICB_PREFIX "PushedRounding");
-        if (window_ptr->StateStorage.GetBool(pushed_round_id)) {
+        if (bar.CacheReplaying && bar.ItemsVtxStart >= 0 && dl->VtxBuffer.Size > bar.ItemsVtxStart) {
+            // Items drew nothing, so this was drawn outside CoolBarItem() blocks and is also in the retained
+            // geometry: it shows twice on this frame, then the bar stops caching
+            bar.CacheUnsafe = true;
+            bar.CacheValid  = false;
+        }
+        flushIconQuads(bar, dl);
+        if (bar.CacheReplaying) {
+            ICB_TRACE_SCOPE("EndCoolBar/Replay", bar.WindowID);
+            replayStaticGeometry(bar, dl);
+            window_ptr->DC.CursorMaxPos = ImMax(window_ptr->DC.CursorMaxPos, bar.CacheCursorMaxPos);
+            window_ptr->DC.IdealMaxPos  = ImMax(window_ptr->DC.IdealMaxPos, bar.CacheIdealMaxPos);
+            if (bar.ItemIdx != bar.CacheItemsCount) {
+                bar.CacheValid = false; // items were added or removed: rebuild next frame
+            }
+        }
+        bar.Stats.vtx_count = dl->VtxBuffer.Size - bar.StatsVtxStart;
+        bar.Stats.idx_count = dl->IdxBuffer.Size - bar.StatsIdxStart;
+        bar.Stats.cmd_count = countDrawCmds(bar, dl);
+        if (bar.PrevDLFlagsSet) {
+            dl->Flags = bar.PrevDLFlags;
+            bar.PrevDLFlagsSet = false;
+        }
+        if (bar.PushedRounding) {
             ImGui::PopStyleVar(); // FrameRounding
-            window_ptr->StateStorage.SetBool(pushed_round_id, false);
+            bar.PushedRounding = false;
+        }
+        // Items that were not submitted this frame restart from the normal size
+        if (bar.ItemSizes.Size != bar.ItemIdx) {
+            bar.ItemSizes.resize(bar.ItemIdx);
+            bar.ItemsChanged = true;
+        }
+        if (bar.ItemVelocities.Size > bar.ItemIdx || bar.ItemSpringOmega <= 0.0f) {
+            bar.ItemVelocities.resize(bar.ItemSpringOmega > 0.0f ? bar.ItemIdx : 0);
+        }
+        compactBarBuffers(bar);
+        // Next frame's pointer service wakes the bar when the pointer comes within a hovered item of it.
+        // The grid only stores cells (rects are read from the bars), so it is rebuilt when a bar changes cells.
+        {
+            ImRect wake_rect = window_ptr->Rect();
+            wake_rect.Expand(ImMax(bar.HoveredSize, bar.NormalSize));
+            int old_range[4], new_range[4];
+            getGridRange(bar.WakeRect, old_range);
+            getGridRange(wake_rect, new_range);
+            if (bar.WakeRectFrame < 0 || memcmp(old_range, new_range, sizeof(new_range)) != 0) {
+                ctx_ptr->GridDirty = true;
+            }
+            bar.WakeRect      = wake_rect;
+            bar.WakeRectFrame = ImGui::GetFrameCount();
+        }
+        // The filtered mouse only moves items while the bubble is visible
+        bar.Animating = !bar.AnimSettled || (bar.AnimScale > 0.0f && !bar.MouseSettled) || bar.ItemsChanged || bar.ItemsSpringing;
+        if (bar.CacheCapturing && !bar.Animating) {
+            ICB_TRACE_SCOPE("EndCoolBar/Capture", bar.WindowID);
+            bar.CacheValid        = captureStaticGeometry(bar, dl);
+            bar.CacheItemsCount   = bar.ItemIdx;
+            bar.CacheCursorMaxPos = window_ptr->DC.CursorMaxPos;
+            bar.CacheIdealMaxPos  = window_ptr->DC.IdealMaxPos;
+        }
+
+        ImCoolBarStats& stats = bar.Stats;
+        stats.items_count   = bar.ItemIdx;
+        stats.anim_scale    = bar.AnimScale;
+        stats.anim_settled  = bar.AnimSettled;
+        stats.mouse_settled = bar.MouseSettled;
+        stats.animating     = bar.Animating;
+        if (bar.CollectTimings) {
+            stats.end_time_us = (float)(getTimeUs() - end_start_us);
+            const int slot = (stats.frame_time_history_offset + stats.frame_time_history_count) % IMCOOLBAR_STATS_HISTORY_SIZE;
+            stats.frame_time_history_us[slot] = stats.begin_time_us + stats.items_time_us + stats.end_time_us;
+            if (stats.frame_time_history_count < IMCOOLBAR_STATS_HISTORY_SIZE) {
+                ++stats.frame_time_history_count;
+            } else {
+                stats.frame_time_history_offset = (stats.frame_time_history_offset + 1) % IMCOOLBAR_STATS_HISTORY_SIZE;
+            }
+        }
+
+        ctx_ptr->BarStack.pop_back();
+        ctx_ptr->CurrentBar = ctx_ptr->BarStack.empty() ? nullptr : ctx_ptr->Bars.GetByIndex(ctx_ptr->BarStack.back());
+        if (ctx_ptr->BarStack.empty() && s_open_ctx_ptr == ctx_ptr) {
+            s_open_owner_ptr = nullptr;
+            s_open_ctx_ptr   = nullptr;
         }
     }
     ImGui::End();
@@ -314,63 +1853,240 @@ IMGUI_API bool ImGui::CoolBarItem() {
     if (window_ptr->SkipItems)
         return false;
 
-    const auto item_index_id = window_ptr->GetID(ICB_PREFIX "ItemIdx");
-    const auto idx = window_ptr->StateStorage.GetInt(item_index_id);
-    const auto coolbar_item_id = window_ptr->GetID(window_ptr->ID + idx + 1);
-    float current_item_size = window_ptr->StateStorage.GetFloat(coolbar_item_id);
-    const auto flags             = window_ptr->StateStorage.GetInt(window_ptr->GetID(ICB_PREFIX "Flags"));
-    const auto anim_scale        = window_ptr->StateStorage.GetFloat(window_ptr->GetID(ICB_PREFIX "AnimScale"));
-    const auto normal_size       = window_ptr->StateStorage.GetFloat(window_ptr->GetID(ICB_PREFIX "NormalSize"));
-    const auto hovered_size      = window_ptr->StateStorage.GetFloat(window_ptr->GetID(ICB_PREFIX "HoveredSize"));
-    const auto effect_strength = window_ptr->StateStorage.GetFloat(window_ptr->GetID(ICB_PREFIX "EffectStrength"));
-    const auto last_mouse_pos_id = window_ptr->GetID(ICB_PREFIX "LastMousePos");
-    auto last_mouse_pos = window_ptr->StateStorage.GetFloat(last_mouse_pos_id);
-
-    assert(normal_size > 0.0f);
-
-    if (flags & ImCoolBarFlags_Horizontal) {
-        if (idx) {
-            ImGui::SameLine();
-        }
+    ImCoolBarState& bar = *getCurrentCoolBar();
+    if (bar.Flags & ImCoolBarFlags_Horizontal) {
+        return bar.SnapItemsToPixels ? coolBarItem<ImCoolBarFlags_Horizontal, true>(window_ptr, bar)
+                                     : coolBarItem<ImCoolBarFlags_Horizontal, false>(window_ptr, bar);
+    }
+    return bar.SnapItemsToPixels ? coolBarItem<ImCoolBarFlags_Vertical, true>(window_ptr, bar)
+                                 : coolBarItem<ImCoolBarFlags_Vertical, false>(window_ptr, bar);
+}
+
+template <ImCoolBarFlags TFlags, bool TSnapItems>
+IMGUI_API bool ImGui::CoolBarItem() {
+    ImGuiWindow* window_ptr = GetCurrentWindow();
+    if (window_ptr->SkipItems)
+        return false;
+
+    ImCoolBarState& bar = *getCurrentCoolBar();
+    IM_ASSERT(bar.Flags == TFlags && "CoolBarItem<> orientation does not match BeginCoolBar()");
+    IM_ASSERT(bar.SnapItemsToPixels == TSnapItems && "CoolBarItem<> snapping does not match ImCoolBarConfig::snap_items_to_pixels");
+    return coolBarItem<TFlags, TSnapItems>(window_ptr, bar);
+}
+
+template bool ImGui::CoolBarItem<ImCoolBarFlags_Horizontal, true>();
+template bool ImGui::CoolBarItem<ImCoolBarFlags_Horizontal, false>();
+template bool ImGui::CoolBarItem<ImCoolBarFlags_Vertical, true>();
+template bool ImGui::CoolBarItem<ImCoolBarFlags_Vertical, false>();
+
+IMGUI_API void ImCoolBarClipper::Begin(int vItemsCount) {
+    IM_ASSERT(vItemsCount >= 0);
+    ImCoolBarState& bar = *getCurrentCoolBar();
+    IM_ASSERT(bar.ItemIdx == 0 && "ImCoolBarClipper::Begin() must be called before the first CoolBarItem()");
+    ItemsCount   = vItemsCount;
+    DisplayStart = 0;
+    DisplayEnd   = 0;
+    StepNo       = 0;
+    if (bar.ItemSizes.Size != vItemsCount) {
+        bar.ItemSizes.resize(vItemsCount, 0.0f);
+        bar.ItemsChanged = true;
     }
+}
 
-    float current_size = normal_size;
+IMGUI_API bool ImCoolBarClipper::Step() {
+    IM_ASSERT(ItemsCount >= 0 && "ImCoolBarClipper::Begin() was not called");
+    if (StepNo > 0) {
+        End();
+        return false;
+    }
+    StepNo = 1;
 
     ImGuiContext& g = *GImGui;
-    
-    // Read filtered mouse, already updated once in BeginCoolBar()
-    last_mouse_pos = window_ptr->StateStorage.GetFloat(window_ptr->GetID(ICB_PREFIX "LastMousePos"));
-    
-    if (current_item_size <= 0.0f) current_item_size = normal_size;
-
-    if (anim_scale > 0.0f) {
-        const auto csp = getChannel(ImGui::GetCursorScreenPos(), flags);
-        const auto ws = getChannel(window_ptr->Size, flags);
-        const auto wp = getChannel(g.Style.WindowPadding, flags);
-        const float btn_center = csp + current_item_size * 0.5f;
-        const float diff_pos = (last_mouse_pos - btn_center) / ws;
-        current_size = getHoverSize(diff_pos, normal_size, hovered_size, effect_strength, anim_scale);
-        const float anchor = window_ptr->StateStorage.GetFloat(window_ptr->GetID(ICB_PREFIX "Anchor"));
-        const float bar_height = getBarSize(normal_size, hovered_size, anim_scale);
-        float btn_offset = (bar_height - current_size) * anchor + wp;
-        if (window_ptr->StateStorage.GetBool(window_ptr->GetID(ICB_PREFIX "SnapItemsToPixels"))) {
-            btn_offset = ImFloor(btn_offset);
+    ImGuiWindow* window_ptr = ImGui::GetCurrentWindow();
+    ImCoolBarState& bar = *getCurrentCoolBar();
+    const ImCoolBarFlags flags = bar.Flags;
+    const float spacing = getChannel(g.Style.ItemSpacing, flags);
+    const float pitch   = bar.NormalSize + spacing;
+
+    // Visible span along the main axis, relative to where the first item goes
+    const float start_pos = getChannel(window_ptr->DC.CursorPos, flags);
+    const float view_min  = getChannel(window_ptr->InnerClipRect.Min, flags) - start_pos;
+    const float view_max  = getChannel(window_ptr->InnerClipRect.Max, flags) - start_pos;
+
+    // Widen by the bubble support so every enlarged item is submitted and skipped ones stay normal. When an item
+    // can be as far from the mouse as the next lobe of the curve, items anywhere may be enlarged: submit them all.
+    int margin = 1;
+    if (bar.AnimScale > 0.0f) {
+        float support = 0.0f, next_lobe = FLT_MAX;
+        getBubbleSupport(bar.NormalSize, bar.HoveredSize, bar.EffectStrength, getChannel(window_ptr->Size, flags), support, next_lobe);
+        const float mouse_pos   = bar.LastMousePos - start_pos;
+        const float content_end = (float)ItemsCount * (ImMax(bar.HoveredSize, bar.NormalSize) + spacing);
+        const float farthest    = ImMax(ImFabs(mouse_pos), ImFabs(content_end - mouse_pos));
+        margin = (support >= (float)ItemsCount * pitch || farthest >= next_lobe) ? ItemsCount : (int)ImCeil(support / pitch) + 1;
+    }
+
+    DisplayStart = ImClamp((int)ImFloor(view_min / pitch) - margin, 0, ItemsCount);
+    int idx = DisplayStart;
+    float pos = (float)DisplayStart * pitch;
+    while (idx < ItemsCount && pos < view_max) {
+        const float size = bar.ItemSizes[idx] > 0.0f ? bar.ItemSizes[idx] : bar.NormalSize;
+        pos += size + spacing;
+        ++idx;
+    }
+    DisplayEnd = ImMin(ItemsCount, idx + margin);
+
+    // Items that left the display range restart from the normal size when they come back
+    for (int i = bar.ClipperStart; i < ImMin(bar.ClipperEnd, ItemsCount); ++i) {
+        if (i < DisplayStart || i >= DisplayEnd) {
+            bar.ItemSizes[i] = 0.0f;
         }
+    }
+    bar.ClipperStart = DisplayStart;
+    bar.ClipperEnd   = DisplayEnd;
+
+    // Skipped leading items: one spacer, then CoolBarItem() continues at DisplayStart
+    if (DisplayStart > 0) {
+        const float extent = (float)DisplayStart * pitch - spacing;
+        ImGui::Dummy((flags & ImCoolBarFlags_Horizontal) ? ImVec2(extent, 0.0f) : ImVec2(0.0f, extent));
+    }
+    bar.ItemIdx = DisplayStart;
+    if (DisplayStart >= DisplayEnd) {
+        End();
+        return false;
+    }
+    return true;
+}
+
+IMGUI_API void ImCoolBarClipper::End() {
+    if (ItemsCount < 0) {
+        return;
+    }
+    ImGuiContext& g = *GImGui;
+    ImCoolBarState& bar = *getCurrentCoolBar();
+    const ImCoolBarFlags flags = bar.Flags;
+    const int skipped = ItemsCount - ImMax(DisplayEnd, bar.ItemIdx);
+    if (skipped > 0) {
+        // Skipped trailing items keep the scroll extent exact
+        const float spacing = getChannel(g.Style.ItemSpacing, flags);
+        const float extent  = (float)skipped * (bar.NormalSize + spacing) - spacing;
         if (flags & ImCoolBarFlags_Horizontal) {
-            ImGui::SetCursorPosY(btn_offset);
-        } else if (flags & ImCoolBarFlags_Vertical) {
-            ImGui::SetCursorPosX(btn_offset);
+            if (bar.ItemIdx > 0) {
+                ImGui::SameLine();
+            }
+            ImGui::Dummy(ImVec2(extent, 0.0f));
+        } else {
+            ImGui::Dummy(ImVec2(0.0f, extent));
         }
     }
+    bar.ItemIdx = ItemsCount;
+    ItemsCount  = -1;
+}
 
-    BREAK_ON_KEY(ImGuiKey_D);
-    window_ptr->StateStorage.SetInt(item_index_id, idx + 1);
-    window_ptr->StateStorage.SetFloat(coolbar_item_id, current_size);
-    window_ptr->StateStorage.SetFloat(last_mouse_pos_id, last_mouse_pos);
-    window_ptr->StateStorage.SetFloat(window_ptr->GetID(ICB_PREFIX "ItemCurrentSize"), current_size);
-    window_ptr->StateStorage.SetFloat(window_ptr->GetID(ICB_PREFIX "ItemCurrentScale"), current_size / normal_size);
+IMGUI_API bool ImGui::CoolBarIcon(ImTextureID vAtlas, const ImVec2& vUV0, const ImVec2& vUV1, const ImVec4& vTintCol) {
+    if (!ImGui::CoolBarItem()) {
+        return false;
+    }
+    ImGuiWindow* window_ptr = GetCurrentWindow();
+    ImCoolBarState& bar = *getCurrentCoolBar();
+    const float size = bar.ItemCurrentSize;
+    const ImVec2 pos = window_ptr->DC.CursorPos;
+    const ImRect rect(pos, pos + ImVec2(size, size));
+    ImGui::ItemSize(rect.GetSize()); // layout only: no ID, no per-item hover logic
 
-    return true;
+    if (!bar.IconQuads.empty() && bar.IconAtlas != vAtlas) {
+        flushIconQuads(bar, window_ptr->DrawList); // the batch shares one texture
+    }
+    if (rect.Overlaps(window_ptr->ClipRect)) {
+        ImCoolBarIconQuad quad;
+        quad.Min = rect.Min;
+        quad.Max = rect.Max;
+        quad.UV0 = vUV0;
+        quad.UV1 = vUV1;
+        quad.Col = ImGui::GetColorU32(vTintCol);
+        bar.IconQuads.push_back(quad);
+        bar.IconAtlas = vAtlas;
+    }
+
+    if (bar.IconClickPending && rect.Contains(ImGui::GetIO().MousePos)) {
+        bar.IconClickPending = false;
+        return true;
+    }
+    return false;
+}
+
+IMGUI_API void ImGui::CoolBarLabel(const char* vText, const char* vTextEnd) {
+    ImGuiWindow* window_ptr = GetCurrentWindow();
+    if (window_ptr->SkipItems) {
+        return;
+    }
+    ImGuiContext& g = *GImGui;
+    ImCoolBarState& bar = *getCurrentCoolBar();
+    if (bar.CacheReplaying) {
+        return; // part of the retained item geometry, like the icon it labels
+    }
+    const ImU32 col = ImGui::GetColorU32(ImGuiCol_Text);
+    if (vTextEnd == nullptr) {
+        vTextEnd = vText + strlen(vText);
+    }
+    if (vText == vTextEnd || (col & IM_COL32_A_MASK) == 0) {
+        return;
+    }
+    ICB_TRACE_SCOPE("CoolBarLabel", bar.WindowID);
+    ++bar.Stats.labels_count;
+
+    const ImGuiID atlas_key = getFontAtlasKey(0);
+    if (bar.LabelAtlasKey != atlas_key || bar.LabelVtx.Size > IMCOOLBAR_LABEL_CACHE_VTX) {
+        flushIconQuads(bar, window_ptr->DrawList); // pending labels refer to cache slots
+        clearLabelCache(bar);
+        bar.LabelAtlasKey = atlas_key;
+    }
+
+    // Quantized sizes keep the cache small while the bubble animates (and limit the sizes baked by the atlas)
+    ImFont* font_ptr = g.Font;
+    const float font_size = ImMax(ImFloor(g.FontSize * bar.ItemCurrentScale / ICB_LABEL_SIZE_STEP + 0.5f) * ICB_LABEL_SIZE_STEP, ICB_LABEL_SIZE_STEP);
+    ImGuiID key = ImHashData(&font_ptr, sizeof(font_ptr));
+    key = ImHashData(&font_size, sizeof(font_size), key);
+    key = ImHashStr(vText, (size_t)(vTextEnd - vText), key);
+    int* slot_ptr = bar.LabelMap.GetIntRef(key, -1);
+    ++bar.Stats.storage_lookups;
+    if (*slot_ptr < 0) {
+        ImCoolBarLabelEntry entry;
+        entry.Key      = key;
+        entry.Size     = font_ptr->CalcTextSizeA(font_size, FLT_MAX, 0.0f, vText, vTextEnd);
+        entry.VtxStart = entry.IdxStart = entry.IdxCount = 0;
+        entry.VtxCount = -1;
+        *slot_ptr = bar.Labels.Size;
+        bar.Labels.push_back(entry);
+        ++bar.Stats.labels_measured;
+    }
+    const int slot = *slot_ptr;
+    const ImVec2 text_size = bar.Labels[slot].Size;
+
+    // Centered on the item, along its bottom edge
+    const float item_size = bar.ItemCurrentSize;
+    const ImVec2 pos = ImFloor(bar.ItemCurrentPos + ImVec2((item_size - text_size.x) * 0.5f, item_size - text_size.y));
+    const ImRect rect(pos, pos + text_size);
+    if (!rect.Overlaps(window_ptr->ClipRect)) {
+        return;
+    }
+    const bool capture = window_ptr->ClipRect.Contains(rect);
+    if (!bar.IconQuads.empty()) {
+        // The icon under this label is still batched: draw the label after the batch
+        ImCoolBarPendingLabel label;
+        label.Slot      = slot;
+        label.Pos       = pos;
+        label.Col       = col;
+        label.Font      = font_ptr;
+        label.FontSize  = font_size;
+        label.TextStart = bar.PendingLabelText.Size;
+        label.TextEnd   = label.TextStart + (int)(vTextEnd - vText);
+        label.Capture   = capture;
+        bar.PendingLabelText.resize(label.TextEnd);
+        memcpy(bar.PendingLabelText.Data + label.TextStart, vText, (size_t)(vTextEnd - vText));
+        bar.PendingLabels.push_back(label);
+        return;
+    }
+    drawLabel(bar, slot, window_ptr->DrawList, font_ptr, font_size, pos, col, vText, vTextEnd, capture);
 }
 
 IMGUI_API float ImGui::GetCoolBarItemWidth() {
@@ -378,8 +2094,7 @@ IMGUI_API float ImGui::GetCoolBarItemWidth() {
     if (window_ptr->SkipItems) {
         return 0.0f;
     }
-    return window_ptr->StateStorage.GetFloat(  //
-        window_ptr->GetID(ICB_PREFIX "ItemCurrentSize"));
+    return getCurrentCoolBar()->ItemCurrentSize;
 }
 
 IMGUI_API float ImGui::GetCoolBarItemScale() {
@@ -387,44 +2102,124 @@ IMGUI_API float ImGui::GetCoolBarItemScale() {
     if (window_ptr->SkipItems) {
         return 0.0f;
     }
+    return getCurrentCoolBar()->ItemCurrentScale;
+}
+
+IMGUI_API bool ImGui::IsCoolBarAnimating(const char* vLabel) {
+    ImGuiContext& g = *GImGui;
+    ImCoolBarContext* ctx_ptr = getCoolBarContext();
+    if (vLabel != nullptr) {
+        const ImCoolBarState* bar_ptr = ctx_ptr->Bars.GetByKey(ImHashStr(vLabel));
+        return bar_ptr != nullptr && bar_ptr->LastActiveFrame >= g.FrameCount - 1 && bar_ptr->Animating;
+    }
+    for (const ImPoolIdx pool_idx : ctx_ptr->Registry) {
+        const ImCoolBarState* bar_ptr = ctx_ptr->Bars.GetByIndex(pool_idx);
+        if (bar_ptr->LastActiveFrame >= g.FrameCount - 1 && bar_ptr->Animating) {
+            return true;
+        }
+    }
+    return false;
+}
+
+IMGUI_API double ImGui::GetCoolBarNextWakeTime(const char* vLabel) {
+    // Transitions are driven by DeltaTime, so an animating bar needs the very next frame.
+    // Idle bars only change on input (mouse enter/move), which wakes the host anyway.
+    return ImGui::IsCoolBarAnimating(vLabel) ? ImGui::GetTime() : (double)FLT_MAX;
+}
+
+IMGUI_API void ImGui::SetNextCoolBarItemsCount(int vItemsCount) {
+    IM_ASSERT(vItemsCount >= 0);
+    getCoolBarContext()->NextItemsCount = vItemsCount;
+}
+
+IMGUI_API void ImGui::InvalidateCoolBarCache(const char* vLabel) {
+    ImCoolBarContext* ctx_ptr = getCoolBarContext();
+    if (vLabel != nullptr) {
+        ImCoolBarState* bar_ptr = ctx_ptr->Bars.GetByKey(ImHashStr(vLabel));
+        if (bar_ptr != nullptr) {
+            bar_ptr->CacheValid  = false;
+            bar_ptr->CacheUnsafe = false;
+        }
+        return;
+    }
+    for (const ImPoolIdx pool_idx : ctx_ptr->Registry) {
+        ImCoolBarState* bar_ptr = ctx_ptr->Bars.GetByIndex(pool_idx);
+        bar_ptr->CacheValid  = false;
+        bar_ptr->CacheUnsafe = false;
+    }
+}
+
+IMGUI_API const ImCoolBarStats* ImGui::GetCoolBarStats(const char* vLabel) {
+    ImCoolBarState* bar_ptr = getCoolBarContext()->Bars.GetByKey(ImHashStr(vLabel));
+    if (bar_ptr == nullptr) {
+        return nullptr;
+    }
+    updateStatsSummary(bar_ptr->Stats);
+    return &bar_ptr->Stats;
+}
+
+IMGUI_API ImCoolBarContextStats ImGui::GetCoolBarContextStats() {
+    ImCoolBarContext* ctx_ptr = getCoolBarContext();
+    ImCoolBarContextStats stats;
+    stats.bars_count  = ctx_ptr->Registry.Size;
+    stats.pool_slots  = ctx_ptr->Bars.GetBufSize();
+    stats.map_entries = ctx_ptr->Bars.Map.Data.Size;
+    stats.footprint_bytes = (size_t)ctx_ptr->Bars.Buf.Capacity * sizeof(ImCoolBarState) + (size_t)ctx_ptr->Bars.Map.Data.Capacity * sizeof(*ctx_ptr->Bars.Map.Data.Data) +
+                            (size_t)(ctx_ptr->Registry.Capacity + ctx_ptr->BarStack.Capacity) * sizeof(ImPoolIdx);
+    for (const ImPoolIdx pool_idx : ctx_ptr->Registry) {
+        stats.footprint_bytes += getBarFootprint(*ctx_ptr->Bars.GetByIndex(pool_idx)) - sizeof(ImCoolBarState); // states counted with the pool
+    }
+    return stats;
+}
 
-    return window_ptr->StateStorage.GetFloat(  //
-        window_ptr->GetID(ICB_PREFIX "ItemCurrentScale"));
+IMGUI_API bool ImGui::SaveCoolBarTrace(const char* vPath) {
+#ifdef IMCOOLBAR_ENABLE_TRACE
+    TraceCollector& collector = getTraceCollector();
+    std::vector<TraceEvent> events;
+    std::unordered_map<ImGuiID, std::string> bar_names;
+    {
+        std::lock_guard<std::mutex> lock(collector.mutex);
+        events.swap(collector.events);
+        bar_names = collector.bar_names;
+    }
+    FILE* file_ptr = fopen(vPath, "w");
+    if (file_ptr == nullptr) {
+        return false;
+    }
+    fprintf(file_ptr, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    for (size_t i = 0; i < events.size(); ++i) {
+        const TraceEvent& ev = events[i];
+        fprintf(file_ptr, "{\"name\":\"%s\",\"cat\":\"ImCoolBar\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"bar_id\":%u,\"bar\":",
+                ev.name, ev.ts_us, ev.dur_us, ev.tid, ev.bar_id);
+        const auto it = bar_names.find(ev.bar_id);
+        writeJsonString(file_ptr, it != bar_names.end() ? it->second.c_str() : "");
+        fprintf(file_ptr, "}}%s\n", i + 1 < events.size() ? "," : "");
+    }
+    fprintf(file_ptr, "]}\n");
+    return fclose(file_ptr) == 0;
+#else
+    IM_UNUSED(vPath);
+    return false;
+#endif
 }
 
 IMGUI_API void ImGui::ShowCoolBarMetrics(bool* vOpened) {
     if (ImGui::Begin("ImCoolBar Metrics", vOpened)) {
         ImGuiContext& g = *GImGui;
-        for (auto* window_ptr : g.Windows) {
-            const char* type = (const char*)window_ptr->StateStorage.GetVoidPtr(window_ptr->GetID(ICB_PREFIX "Type"));
-            if (type != nullptr && strcmp(type, "ImCoolBar") == 0) {
-                if (!TreeNode(window_ptr, "ImCoolBar %s", window_ptr->Name)) {
-                    continue;
-                }
-
-                const auto flags_id = window_ptr->GetID(ICB_PREFIX "Flags");
-                const auto anchor_id = window_ptr->GetID(ICB_PREFIX "Anchor");
-                const auto anim_scale_id = window_ptr->GetID(ICB_PREFIX "AnimScale");
-                const auto item_index_id = window_ptr->GetID(ICB_PREFIX "ItemIdx");
-                const auto normal_size_id = window_ptr->GetID(ICB_PREFIX "NormalSize");
-                const auto hovered_size_id = window_ptr->GetID(ICB_PREFIX "HoveredSize");
-                const auto effect_strength_id = window_ptr->GetID(ICB_PREFIX "EffectStrength");
-                const auto item_current_size_id = window_ptr->GetID(ICB_PREFIX "ItemCurrentSize");
-                const auto item_current_scale_id = window_ptr->GetID(ICB_PREFIX "ItemCurrentScale");
-                const auto ema_hl_id = window_ptr->GetID(ICB_PREFIX "MouseSmoothingMs");
-                const auto ema_alpha_id = window_ptr->GetID(ICB_PREFIX "MouseSmoothingAlpha");
-                const auto ema_anim_hl_id = window_ptr->GetID(ICB_PREFIX "AnimSmoothingMs");
-                const auto ema_anim_alpha_id = window_ptr->GetID(ICB_PREFIX "AnimSmoothingAlpha");
-
-                const auto flags = window_ptr->StateStorage.GetInt(flags_id);
-                const auto anchor = window_ptr->StateStorage.GetFloat(anchor_id);
-                const auto max_idx = window_ptr->StateStorage.GetInt(item_index_id);
-                const auto anim_scale = window_ptr->StateStorage.GetFloat(anim_scale_id);
-                const auto normal_size = window_ptr->StateStorage.GetFloat(normal_size_id);
-                const auto hovered_size = window_ptr->StateStorage.GetFloat(hovered_size_id);
-                const auto effect_strength = window_ptr->StateStorage.GetFloat(effect_strength_id);
-                const auto item_current_size = window_ptr->StateStorage.GetFloat(item_current_size_id);
-                const auto item_current_scale = window_ptr->StateStorage.GetFloat(item_current_scale_id);
+        ImCoolBarContext* ctx_ptr = getCoolBarContext();
+        const ImCoolBarContextStats ctx_stats = ImGui::GetCoolBarContextStats();
+        ImGui::Text("Bars: %i (pool slots: %i, map entries: %i, footprint: %.1f KB)", ctx_stats.bars_count, ctx_stats.pool_slots, ctx_stats.map_entries,
+                    (double)ctx_stats.footprint_bytes / 1024.0);
+        for (const ImPoolIdx pool_idx : ctx_ptr->Registry) {
+            ImCoolBarState* bar_ptr = ctx_ptr->Bars.GetByIndex(pool_idx);
+            const ImGuiWindow* window_ptr = ImGui::FindWindowByID(bar_ptr->WindowID);
+            if (!TreeNode((void*)(intptr_t)bar_ptr->WindowID, "ImCoolBar %s (seen %i frames ago)",  //
+                          window_ptr != nullptr ? window_ptr->Name : "?", g.FrameCount - bar_ptr->LastActiveFrame)) {
+                continue;
+            }
+            ImCoolBarState& bar = *bar_ptr;
+            const auto flags = bar.Flags;
+            const auto max_idx = bar.ItemIdx;
 
 #define SetColumnLabel(a, fmt, v) \
     ImGui::TableNextColumn();     \
@@ -433,55 +2228,87 @@ IMGUI_API void ImGui::ShowCoolBarMetrics(bool* vOpened) {
     ImGui::Text(fmt, v);          \
     ImGui::TableNextRow()
 
-                if (ImGui::BeginTable("CoolbarDebugDatas", 2)) {
-                    ImGui::TableSetupScrollFreeze(0, 1);
-                    ImGui::TableSetupColumn("Label", ImGuiTableColumnFlags_WidthFixed);
-                    ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthStretch);
-                    ImGui::TableHeadersRow();
-
-                    SetColumnLabel("MaxIdx ", "%i", max_idx);
-                    SetColumnLabel("Anchor ", "%f", anchor);
-                    SetColumnLabel("AnimScale ", "%f", anim_scale);
-                    SetColumnLabel("NormalSize ", "%f", normal_size);
-                    SetColumnLabel("HoveredSize ", "%f", hovered_size);
-                    SetColumnLabel("EffectStrength ", "%f", effect_strength);
-                    SetColumnLabel("ItemCurrentSize ", "%f", item_current_size);
-                    SetColumnLabel("ItemCurrentScale ", "%f", item_current_scale);
-                    SetColumnLabel("MouseSmoothingMs  ", "%f", window_ptr->StateStorage.GetFloat(ema_hl_id));
-                    SetColumnLabel("MouseSmoothingAlpha ", "%f", window_ptr->StateStorage.GetFloat(ema_alpha_id));
-                    SetColumnLabel("AnimSmoothingMs ", "%f", window_ptr->StateStorage.GetFloat(ema_anim_hl_id));
-                    SetColumnLabel("AnimSmoothingAlpha ", "%f", window_ptr->StateStorage.GetFloat(ema_anim_alpha_id));
-                    
+            if (ImGui::BeginTable("CoolbarDebugDatas", 2)) {
+                ImGui::TableSetupScrollFreeze(0, 1);
+                ImGui::TableSetupColumn("Label", ImGuiTableColumnFlags_WidthFixed);
+                ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableHeadersRow();
+
+                SetColumnLabel("MaxIdx ", "%i", max_idx);
+                SetColumnLabel("Anchor ", "%f", bar.Anchor);
+                SetColumnLabel("AnimScale ", "%f", bar.AnimScale);
+                SetColumnLabel("NormalSize ", "%f", bar.NormalSize);
+                SetColumnLabel("HoveredSize ", "%f", bar.HoveredSize);
+                SetColumnLabel("EffectStrength ", "%f", bar.EffectStrength);
+                SetColumnLabel("ItemCurrentSize ", "%f", bar.ItemCurrentSize);
+                SetColumnLabel("ItemCurrentScale ", "%f", bar.ItemCurrentScale);
+                SetColumnLabel("MouseSmoothingMs  ", "%f", bar.MouseSmoothingMs);
+                SetColumnLabel("MouseSmoothingAlpha ", "%f", bar.MouseSmoothingAlpha);
+                SetColumnLabel("MouseFilter ", "%s", bar.MouseFilter == ImCoolBarMouseFilter_OneEuro ? "OneEuro" : bar.MouseFilter == ImCoolBarMouseFilter_Predictive ? "Predictive" : "Ema");
+                SetColumnLabel("MouseFilterDelayMs ", "%.1f", bar.MouseFilterDelayMs);
+                SetColumnLabel("AnimSmoothingMs ", "%f", bar.AnimSmoothingMs);
+                SetColumnLabel("AnimSmoothingAlpha ", "%f", bar.AnimSmoothingAlpha);
+                SetColumnLabel("Animating ", "%s", bar.Animating ? "true" : "false");
+                
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", "Flags ");
+                ImGui::TableNextColumn();
+                if (flags & ImCoolBarFlags_None) {
+                    ImGui::Text("None");
+                }
+                if (flags & ImCoolBarFlags_Vertical) {
+                    ImGui::Text("Vertical");
+                }
+                if (flags & ImCoolBarFlags_Horizontal) {
+                    ImGui::Text("Horizontal");
+                }
+                ImGui::TableNextRow();
+
+                ImCoolBarStats& stats = bar.Stats;
+                updateStatsSummary(stats);
+                SetColumnLabel("ItemsChanged ", "%i", stats.items_changed);
+                SetColumnLabel("StorageLookups ", "%i", stats.storage_lookups);
+                SetColumnLabel("Vertices ", "%i", stats.vtx_count);
+                SetColumnLabel("Indices ", "%i", stats.idx_count);
+                SetColumnLabel("DrawCmds ", "%i", stats.cmd_count);
+                SetColumnLabel("QualityLevel ", "%i", stats.quality_level);
+                SetColumnLabel("QualityFrameMs ", "%.2f", stats.quality_frame_ms);
+                SetColumnLabel("ItemsCulled ", "%i", stats.items_culled);
+                SetColumnLabel("CacheReplayed ", "%s", stats.replayed ? "true" : "false");
+                SetColumnLabel("Dormant ", "%s", stats.dormant ? "true" : "false");
+                SetColumnLabel("CacheVertices ", "%i", bar.CacheVtx.Size);
+                SetColumnLabel("FootprintBytes ", "%i", (int)getBarFootprint(bar));
+                SetColumnLabel("Labels ", "%i", stats.labels_count);
+                SetColumnLabel("LabelsMeasured ", "%i", stats.labels_measured);
+                SetColumnLabel("LabelCacheEntries ", "%i", bar.Labels.Size);
+                if (bar.CollectTimings) {
+                    SetColumnLabel("BeginTimeUs ", "%.2f", stats.begin_time_us);
+                    SetColumnLabel("ItemsTimeUs ", "%.2f", stats.items_time_us);
+                    SetColumnLabel("EndTimeUs ", "%.2f", stats.end_time_us);
+                    SetColumnLabel("FrameTimeMinUs ", "%.2f", stats.frame_time_min_us);
+                    SetColumnLabel("FrameTimeAvgUs ", "%.2f", stats.frame_time_avg_us);
+                    SetColumnLabel("FrameTimeP99Us ", "%.2f", stats.frame_time_p99_us);
                     ImGui::TableNextColumn();
-                    ImGui::Text("%s", "Flags ");
+                    ImGui::Text("%s", "FrameTimeUs ");
                     ImGui::TableNextColumn();
-                    if (flags & ImCoolBarFlags_None) {
-                        ImGui::Text("None");
-                    }
-                    if (flags & ImCoolBarFlags_Vertical) {
-                        ImGui::Text("Vertical");
-                    }
-                    if (flags & ImCoolBarFlags_Horizontal) {
-                        ImGui::Text("Horizontal");
-                    }
+                    ImGui::PlotHistogram("##FrameTimeUs", stats.frame_time_history_us, stats.frame_time_history_count,
+                                         stats.frame_time_history_offset, nullptr, 0.0f, stats.frame_time_p99_us * 1.25f, ImVec2(0.0f, 40.0f));
                     ImGui::TableNextRow();
+                }
 
-                    for (int idx = 0; idx < max_idx; ++idx) {
-                        const auto coolbar_item_id = window_ptr->GetID(window_ptr->ID + idx + 1);
-                        const auto current_item_size = window_ptr->StateStorage.GetFloat(coolbar_item_id);
-                        ImGui::TableNextColumn();
-                        ImGui::Text("Item %i Size ", idx);
-                        ImGui::TableNextColumn();
-                        ImGui::Text("%f", current_item_size);
-                        ImGui::TableNextRow();
-                    }
-
-                    ImGui::EndTable();
+                for (int idx = 0; idx < ImMin(max_idx, bar.ItemSizes.Size); ++idx) {
+                    ImGui::TableNextColumn();
+                    ImGui::Text("Item %i Size ", idx);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%f", bar.ItemSizes[idx]);
+                    ImGui::TableNextRow();
                 }
 
+                ImGui::EndTable();
+            }
+
 #undef SetColumnLabel
-                TreePop();
-            } 
+            TreePop();
         }
     }
     ImGui::End();
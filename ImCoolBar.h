@@ -40,12 +40,29 @@ enum ImCoolBarFlags_ {
     ImCoolBarFlags_Horizontal = (1 << 1),  ///< Arrange items horizontally.
 };
 
+/// \brief Filter applied to the mouse position along the bar's main axis.
+typedef int ImCoolBarMouseFilter;          ///< Alias for \c ImCoolBarMouseFilter_ values.
+enum ImCoolBarMouseFilter_ {
+    ImCoolBarMouseFilter_Ema        = 0,   ///< Fixed EMA with \c mouse_smoothing_ms half-life.
+    ImCoolBarMouseFilter_OneEuro    = 1,   ///< One Euro filter: cutoff rises with pointer speed (low jitter slow, low lag fast).
+    ImCoolBarMouseFilter_Predictive = 2,   ///< One Euro plus velocity extrapolation by \c mouse_prediction_ms.
+};
+
+/// \brief Quality levels of the adaptive governor (\c ImCoolBarConfig::adaptive_quality); each level includes the previous ones.
+typedef int ImCoolBarQuality;              ///< Alias for \c ImCoolBarQuality_ values.
+enum ImCoolBarQuality_ {
+    ImCoolBarQuality_Full    = 0,          ///< Configured settings.
+    ImCoolBarQuality_NoAA    = 1,          ///< Local antialiasing and the rounding override are dropped.
+    ImCoolBarQuality_Reduced = 2,          ///< Mouse filter falls back to EMA, item springs are off.
+    ImCoolBarQuality_Minimal = 3,          ///< Hover ramp jumps to its target, item sizes snap to whole pixels.
+};
+
 /// \brief Configuration parameters for \c ImCoolBar.
 struct ImCoolBarConfig {
     ImVec2 anchor                    = ImVec2(-1.0f, -1.0f);  ///< Anchor within the viewport [0..1].
     float normal_size                = 40.0f;                 ///< Default item size in pixels.
     float hovered_size               = 60.0f;                 ///< Item size when fully hovered (px).
-    float anim_step                  = 0.15f;                 ///< Step for animation when smoothing is disabled.
+    float anim_step                  = 0.15f;                 ///< Step per frame when smoothing is disabled (see \c anim_step_per_second).
     float effect_strength            = 0.5f;                  ///< Strength of the hover bubble effect [0..1].
     float mouse_smoothing_ms         = 50.0f;                 ///< EMA half-life for mouse smoothing in ms (<=0 disables).
     float anim_smoothing_ms          = 50.0f;                 ///< EMA half-life for animation smoothing in ms (<=0 uses step).
@@ -53,6 +70,19 @@ struct ImCoolBarConfig {
     bool snap_items_to_pixels        = true;                  ///< Snap internal item offsets to integer pixels.
     bool local_antialiasing          = true;                  ///< Enable antialiasing only for the bar.
     float frame_rounding_override    = -1.0f;                 ///< <0 keeps style, >=0 pushes FrameRounding.
+    bool collect_timings             = false;                 ///< Measure CPU time of Begin/Item/End into \c ImCoolBarStats (two clock reads per call).
+    bool cache_static_geometry       = false;                 ///< Replay the last static frame's geometry while the bar is idle, see \c InvalidateCoolBarCache().
+    ImCoolBarMouseFilter mouse_filter = ImCoolBarMouseFilter_Ema;  ///< Mouse filter along the main axis.
+    float mouse_min_cutoff_hz        = 2.0f;                  ///< One Euro/predictive: cutoff at rest in Hz (lower = less jitter, more lag).
+    float mouse_beta                 = 0.02f;                 ///< One Euro/predictive: cutoff increase in Hz per px/s of filtered speed.
+    float mouse_deriv_cutoff_hz      = 5.0f;                  ///< One Euro/predictive: cutoff of the speed estimate in Hz.
+    float mouse_prediction_ms        = 8.0f;                  ///< Predictive: lead time of the extrapolation (capped at \c normal_size px).
+    bool exact_layout                = false;                 ///< Solve item sizes and the window rect for this frame in \c BeginCoolBar() (no one-frame lag).
+    float anim_spring_settle_ms      = 0.0f;                  ///< >0: hover ramp follows a critically damped spring settling within 1% in this time (overrides EMA/step).
+    float item_spring_settle_ms      = 0.0f;                  ///< >0: each item size follows a critically damped spring toward its bubble size.
+    float anim_step_per_second       = 0.0f;                  ///< >0: the step ramp advances this much per second instead of \c anim_step per frame.
+    bool adaptive_quality            = false;                 ///< Items outside the bubble's support skip the curve; quality steps down while over \c frame_budget_ms.
+    float frame_budget_ms            = 20.0f;                 ///< Adaptive quality: averaged DeltaTime budget in ms.
     /// \brief Construct with optional parameter overrides.
     /// \param vAnchor Anchor within the viewport [0..1].
     /// \param vNormalSize Normal item size in pixels.
@@ -93,6 +123,107 @@ struct ImCoolBarConfig {
     }
 };
 
+#define IMCOOLBAR_STATS_HISTORY_SIZE 120  ///< Frames kept in the per-bar frame-cost history.
+
+/// \brief Per-bar counters of the last submitted frame, see \c ImGui::GetCoolBarStats().
+struct ImCoolBarStats {
+    int   frame                = -1;     ///< ImGui frame the counters belong to.
+    int   items_count          = 0;      ///< Items submitted.
+    int   items_changed        = 0;      ///< Items whose size changed by at least a sub-pixel.
+    int   storage_lookups      = 0;      ///< Keyed lookups of the frame: context and bar state in \c BeginCoolBar() (plus bar and window for \c exact_layout), one per \c CoolBarLabel(). Items reuse the bar's.
+    float begin_time_us        = 0.0f;   ///< CPU time in \c BeginCoolBar() (needs \c collect_timings).
+    float items_time_us        = 0.0f;   ///< CPU time in all \c CoolBarItem() calls (needs \c collect_timings).
+    float end_time_us          = 0.0f;   ///< CPU time in \c EndCoolBar() (needs \c collect_timings).
+    int   vtx_count            = 0;      ///< Vertices emitted into the bar's draw list.
+    int   idx_count            = 0;      ///< Indices emitted into the bar's draw list.
+    int   cmd_count            = 0;      ///< Draw commands holding the bar's indices.
+    float anim_scale           = 0.0f;   ///< Hover ramp [0..1].
+    bool  anim_settled         = true;   ///< Hover ramp reached its target.
+    bool  mouse_settled        = true;   ///< Filtered mouse reached the raw mouse.
+    bool  animating            = false;  ///< Another frame is needed to finish a transition.
+    bool  replayed             = false;  ///< Geometry was replayed from the static-frame cache (items were skipped).
+    bool  dormant              = false;  ///< Settled and away from the pointer: hover ramp and mouse filter were skipped.
+    float mouse_filter_delay_ms = 0.0f;  ///< Measured lag of the filtered mouse behind the raw mouse while moving (ms, <0 leads).
+    int   labels_count         = 0;      ///< \c CoolBarLabel() calls.
+    int   labels_measured      = 0;      ///< Labels measured this frame (new text, font or quantized size).
+    int   quality_level        = 0;      ///< Active \c ImCoolBarQuality level (0 unless \c adaptive_quality).
+    float quality_frame_ms     = 0.0f;   ///< Averaged DeltaTime watched by the quality governor (ms).
+    int   items_culled         = 0;      ///< Items kept at normal size outside the bubble's support (\c adaptive_quality).
+    float frame_time_min_us    = 0.0f;   ///< Min Begin+Items+End time over the history.
+    float frame_time_avg_us    = 0.0f;   ///< Average Begin+Items+End time over the history.
+    float frame_time_p99_us    = 0.0f;   ///< 99th percentile Begin+Items+End time over the history.
+    float frame_time_history_us[IMCOOLBAR_STATS_HISTORY_SIZE] = {};  ///< Ring buffer of Begin+Items+End times.
+    int   frame_time_history_offset = 0; ///< Index of the oldest entry in the ring buffer.
+    int   frame_time_history_count  = 0; ///< Valid entries in the ring buffer.
+};
+
+/// \brief Counters of the CoolBar data owned by the current ImGui context, see \c ImGui::GetCoolBarContextStats().
+struct ImCoolBarContextStats {
+    int    bars_count      = 0;  ///< Live bars.
+    int    pool_slots      = 0;  ///< Bar state slots, live or free.
+    int    map_entries     = 0;  ///< Entries of the bar ID map (one per live bar once pruned).
+    size_t footprint_bytes = 0;  ///< Memory held by the bar states, their buffers and the context containers.
+};
+
+/// \brief Input of \c ImGui::CoolBarLayout(): everything that shapes a bar's items, no ImGui state.
+/// \details Positions are on the bar's main axis unless stated otherwise; the caller picks the axis.
+struct ImCoolBarLayoutInput {
+    int          items_count          = 0;        ///< Items to lay out.
+    const float* prev_sizes           = nullptr;  ///< [items_count] sizes of the previous frame (<=0 or \c nullptr = normal), they place item centers.
+    float        start_pos            = 0.0f;     ///< Leading edge of the first item (screen px).
+    float        item_spacing         = 0.0f;     ///< Gap between two items (px).
+    float        bar_extent           = 1.0f;     ///< Bar size along the main axis (px, >0).
+    float        mouse_pos            = 0.0f;     ///< Filtered mouse position (screen px).
+    float        anim_scale           = 0.0f;     ///< Hover ramp [0..1].
+    float        normal_size          = 40.0f;    ///< Default item size in pixels.
+    float        hovered_size         = 60.0f;    ///< Item size when fully hovered (px).
+    float        effect_strength      = 0.5f;     ///< Bubble effect strength [0..1].
+    float        anchor               = 0.0f;     ///< Cross-axis anchor [0..1].
+    float        cross_padding        = 0.0f;     ///< Window padding before the items on the cross axis (px).
+    bool         snap_items_to_pixels = true;     ///< Floor the cross-axis offsets.
+    int          center_iterations    = 0;        ///< 0: one pass, centers from \c prev_sizes (like \c CoolBarItem()); >0: at most this many refining passes per block of items (see \c CoolBarLayout()).
+};
+
+/// \brief Output of \c ImGui::CoolBarLayout(); the arrays are owned by the caller.
+struct ImCoolBarLayoutOutput {
+    float* sizes         = nullptr;  ///< [items_count] item sizes (required).
+    float* cross_offsets = nullptr;  ///< [items_count] item offsets on the cross axis, window-relative (optional).
+    float  bar_size      = 0.0f;     ///< Cross-axis thickness of the items area (px).
+    float  main_extent   = 0.0f;     ///< Main-axis length of the items, spacing included (px).
+};
+
+/// \brief Submit only the items of a long CoolBar that can be visible this frame.
+/// \details Works like \c ImGuiListClipper: call \c Begin() right after \c BeginCoolBar(),
+/// then loop on \c Step() and submit items [\c DisplayStart, \c DisplayEnd). The range covers the
+/// visible part of the bar widened by the bubble's reach, so every enlarged item is submitted and
+/// skipped items are accounted for at their normal size. Scroll the bar window to move through items.
+/// \code
+/// ImCoolBarClipper clipper;
+/// clipper.Begin(items_count);
+/// while (clipper.Step())
+///     for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+///         if (ImGui::CoolBarItem())
+///             ImGui::Button(labels[i]);
+/// \endcode
+struct ImCoolBarClipper {
+    int DisplayStart = 0;   ///< First item to submit.
+    int DisplayEnd   = 0;   ///< End of the items to submit (exclusive).
+    int ItemsCount   = -1;  ///< Total items in the bar (-1 outside Begin/End).
+    int StepNo       = 0;   ///< Internal step counter.
+
+    ~ImCoolBarClipper() { IM_ASSERT(ItemsCount == -1 && "Forgot to call End(), or to Step() until false?"); }
+
+    /// \brief Start clipping the current CoolBar.
+    /// \param vItemsCount Total number of items in the bar.
+    IMGUI_API void Begin(int vItemsCount);
+
+    /// \brief Compute the range to submit; returns \c false once every item is accounted for.
+    IMGUI_API bool Step();
+
+    /// \brief Account for the remaining items (called automatically by the last \c Step()).
+    IMGUI_API void End();
+};
+
 namespace ImGui {
 
 /// \brief Begin a CoolBar container.
@@ -115,10 +246,56 @@ IMGUI_API bool BeginCoolBar(const char* vLabel, ImCoolBarFlags vCBFlags = ImCool
 /// \brief Close the current CoolBar container.
 IMGUI_API void EndCoolBar();
 
+/// \brief Set the item count of the next \c BeginCoolBar() for \c ImCoolBarConfig::exact_layout.
+/// \details Exact layout solves the bar before \c ImGui::Begin() and assumes last frame's item count
+/// otherwise; call this when the count changes (or always) so the first frame after a change is exact too.
+/// \param vItemsCount Items the next bar will submit.
+IMGUI_API void SetNextCoolBarItemsCount(int vItemsCount);
+
 /// \brief Declare an item inside the current CoolBar.
 /// \return \c true when the item can be rendered.
 IMGUI_API bool CoolBarItem();
 
+/// \brief \c BeginCoolBar() with the orientation fixed at compile time, to pair with \c CoolBarItem<TFlags>().
+/// \tparam TFlags \c ImCoolBarFlags_Horizontal or \c ImCoolBarFlags_Vertical.
+template <ImCoolBarFlags TFlags>
+inline bool BeginCoolBar(const char* vLabel, const ImCoolBarConfig& vConfig = {}, ImGuiWindowFlags vFlags = ImGuiWindowFlags_None) {
+    static_assert(TFlags == ImCoolBarFlags_Horizontal || TFlags == ImCoolBarFlags_Vertical, "exactly one orientation flag");
+    return BeginCoolBar(vLabel, TFlags, vConfig, vFlags);
+}
+
+/// \brief \c CoolBarItem() with orientation and item snapping fixed at compile time.
+/// \details The per-item path has no orientation or snapping branches. Both must match the bar
+/// (asserted). Instantiated for both orientations and both snapping modes.
+/// \tparam TFlags \c ImCoolBarFlags_Horizontal or \c ImCoolBarFlags_Vertical.
+/// \tparam TSnapItems Value of \c ImCoolBarConfig::snap_items_to_pixels.
+/// \return \c true when the item can be rendered.
+template <ImCoolBarFlags TFlags, bool TSnapItems = true>
+IMGUI_API bool CoolBarItem();
+
+/// \brief Declare an item drawn as a scaled atlas sub-image.
+/// \details Replaces \c CoolBarItem() + \c ImageButton() for icon docks: the item only reserves
+/// layout space, its quad is batched and drawn in \c EndCoolBar() with one texture and one
+/// draw command, and a click is matched against the icons once per bar (no IDs, no per-item
+/// hover logic). Icons are drawn on top of other widgets of the bar, except \c CoolBarLabel() text.
+/// \param vAtlas Texture shared by the bar's icons (a texture change starts a new batch).
+/// \param vUV0 Atlas UV of the top-left corner.
+/// \param vUV1 Atlas UV of the bottom-right corner.
+/// \param vTintCol Tint color.
+/// \return \c true if the icon was clicked this frame.
+IMGUI_API bool CoolBarIcon(ImTextureID vAtlas, const ImVec2& vUV0 = ImVec2(0.0f, 0.0f), const ImVec2& vUV1 = ImVec2(1.0f, 1.0f), const ImVec4& vTintCol = ImVec4(1.0f, 1.0f, 1.0f, 1.0f));
+
+/// \brief Draw a text label scaled with the last item, centered along its bottom edge.
+/// \details The font size is \c GetFontSize() * \c GetCoolBarItemScale(), quantized to 0.5 px.
+/// Extents and glyph quads are cached per bar, keyed by text, font and quantized size, so an
+/// animating label is only measured and laid out once per size; later frames copy the cached
+/// quads. The cache starts over when the font atlas texture changes. Takes no layout space.
+/// While \c CoolBarIcon() quads are batched, the label is drawn right after the batch, on top of the icons.
+/// Draws nothing while \c cache_static_geometry replays the bar: the label is part of the retained geometry.
+/// \param vText Label text.
+/// \param vTextEnd End of the text (\c nullptr for a zero-terminated string).
+IMGUI_API void CoolBarLabel(const char* vText, const char* vTextEnd = nullptr);
+
 /// \brief Get the width of the last CoolBar item in pixels.
 /// \return Item size along the bar's main axis.
 IMGUI_API float GetCoolBarItemWidth();
@@ -127,6 +304,84 @@ IMGUI_API float GetCoolBarItemWidth();
 /// \return Scale factor where 1.0 is the normal size.
 IMGUI_API float GetCoolBarItemScale();
 
+/// \brief Compute hover (bubble) sizes for a batch of item centers in one pass.
+/// \details Used by the refined passes of \c CoolBarLayout() (so by \c exact_layout bars) and by any code
+/// laying out many items at once. \c CoolBarItem() evaluates the same curve one item at a time.
+/// Runs 8 lanes with AVX, 4 lanes with SSE2/NEON and a scalar loop for the tail.
+/// The \c cos^12 bubble is evaluated with a range-reduced polynomial: absolute error vs
+/// the exact curve is below 4e-6 while the mouse is within 4 bar extents of the item
+/// (under 1e-4 px for a 20 px size delta), and never worse than the former
+/// \c pow(cos(x),12) evaluation from a float argument.
+/// \param vCenters Item centers along the bar's main axis (screen px).
+/// \param vOutSizes Output sizes, \p vCount entries; may alias \p vCenters.
+/// \param vCount Number of items.
+/// \param vMousePos Filtered mouse position along the main axis (screen px).
+/// \param vBarExtent Bar size along the main axis (px, >0).
+/// \param vNormalSize Default item size in pixels.
+/// \param vHoveredSize Item size when fully hovered (px).
+/// \param vEffectStrength Bubble effect strength [0..1].
+/// \param vAnimScale Hover ramp [0..1].
+IMGUI_API void CoolBarBubbleSizes(const float* vCenters, float* vOutSizes, int vCount, float vMousePos, float vBarExtent, float vNormalSize, float vHoveredSize, float vEffectStrength, float vAnimScale);
+
+/// \brief Lay out the items of a bar: per-item sizes and cross-axis offsets.
+/// \details Pure and reentrant: reads only its arguments and writes only \p vOutput, so it can run
+/// on worker threads or for several ImGui contexts at once. Items are placed one after another,
+/// each centered on its previous size. \c CoolBarItem() does not call it: it evaluates the same per-item
+/// kernel inline (templated on orientation and snapping) at the cursor ImGui gives it, so with
+/// \c center_iterations = 0 both give the same sizes for the same inputs. With \c center_iterations > 0
+/// every item is centered on its own new size (fixed point): blocks of 8 items are placed one after
+/// another and each block is evaluated in one batch of the \c CoolBarBubbleSizes() kernel (SIMD), again
+/// with the centers of the new sizes, until no size moves by more than 0.001 px or \c center_iterations
+/// passes ran. \c BeginCoolBar() calls it that way for \c ImCoolBarConfig::exact_layout.
+/// \param vInput Bar parameters and item count.
+/// \param vOutput Caller-owned arrays to fill, and scalar results.
+IMGUI_API void CoolBarLayout(const ImCoolBarLayoutInput& vInput, ImCoolBarLayoutOutput& vOutput);
+
+/// \brief Tell whether a CoolBar still needs frames to finish a transition.
+/// \details Hover ramps and mouse smoothing are snapped to their target once within a
+/// sub-pixel, so an idle bar reports \c false and the host may sleep until the next input event.
+/// \param vLabel Bar label, or \c nullptr to check every bar submitted in the last frame.
+/// \return \c true if another frame should be rendered.
+IMGUI_API bool IsCoolBarAnimating(const char* vLabel = nullptr);
+
+/// \brief Get the time at which the host should render the next frame for CoolBars.
+/// \param vLabel Bar label, or \c nullptr for every bar submitted in the last frame.
+/// \return Time on the \c ImGui::GetTime() clock: the current time while animating,
+/// \c FLT_MAX when idle (wake only on input).
+IMGUI_API double GetCoolBarNextWakeTime(const char* vLabel = nullptr);
+
+/// \brief Drop the retained geometry of a CoolBar so its next static frame is rebuilt.
+/// \details With \c cache_static_geometry, an idle bar (not hovered, hover ramp at 0, same item
+/// count, window position, style, font and config as the retained frame) replays the geometry of
+/// its last static frame: \c CoolBarItem() returns \c false and \c EndCoolBar() copies the retained
+/// vertices/indices into the draw list. Call this before \c BeginCoolBar() when the content drawn
+/// inside items changes without changing the bar's layout (icon, label, color...).
+/// Draw only inside \c CoolBarItem() blocks: content submitted before the first item is not retained and is
+/// drawn normally, but content drawn after an item outside its \c if block would be drawn twice on replay.
+/// A bar that does it is detected on its first replay (one frame shows it twice) and stops caching
+/// until this function is called for it.
+/// \param vLabel Bar label, or \c nullptr for every bar.
+IMGUI_API void InvalidateCoolBarCache(const char* vLabel = nullptr);
+
+/// \brief Get the counters of a CoolBar for its last submitted frame.
+/// \details Min/avg/p99 frame costs are computed from the history on each call.
+/// \param vLabel Bar label as passed to \c BeginCoolBar().
+/// \return Stats owned by the bar, or \c nullptr if no such bar exists.
+IMGUI_API const ImCoolBarStats* GetCoolBarStats(const char* vLabel);
+
+/// \brief Get the counters of the CoolBar data of the current ImGui context.
+/// \details Bars unused for \c io.ConfigMemoryCompactTimer seconds are freed with their map entries,
+/// so these stay flat when bars with generated labels come and go.
+IMGUI_API ImCoolBarContextStats GetCoolBarContextStats();
+
+/// \brief Write the CoolBar trace events collected so far as Chrome trace JSON and clear them.
+/// \details Only available when compiled with \c IMCOOLBAR_ENABLE_TRACE; otherwise the hot paths
+/// carry no instrumentation and this returns \c false. Timestamps are \c std::chrono::steady_clock
+/// microseconds so they line up with host spans taken on the same clock.
+/// \param vPath Output file, loadable in chrome://tracing or Perfetto.
+/// \return \c true if the file was written.
+IMGUI_API bool SaveCoolBarTrace(const char* vPath);
+
 /// \brief Show a debug window with internal CoolBar metrics.
 /// \param vOpened Pointer to the window open state.
 IMGUI_API void ShowCoolBarMetrics(bool* vOpened);
@@ -0,0 +1,324 @@
+/*
+MIT License
+
+Copyright (c) 2025 NewYaroslav
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "ImCoolBarIcons.h"
+#include "imgui_internal.h"
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+// Threading: the entry map, the LRU list and the upload queue belong to the UI thread. Workers only see
+// the job queue and the result list, both guarded by the mutex. Containers are STL (not ImVector) because
+// ImGui::MemAlloc() updates the current context's allocation counters and must stay on the UI thread.
+
+namespace {
+
+    enum IconState {
+        IconState_Pending = 0,  ///< Queued or being decoded.
+        IconState_Decoded,      ///< Pixels ready, waiting for an upload.
+        IconState_Ready,        ///< Texture created.
+        IconState_Failed,       ///< Decode or upload failed: the placeholder stays.
+    };
+
+    /// \brief One cached icon (UI thread).
+    struct IconEntry {
+        ImGuiID                    id         = 0;                  ///< Hash of \c key (keys may collide: compare \c key too).
+        std::string                key;                             ///< Key passed to the decoder.
+        IconState                  state      = IconState_Pending;  ///< Pipeline stage.
+        unsigned int               generation = 0;                  ///< Matches results to the request that is still wanted.
+        std::vector<unsigned char> rgba;                            ///< Decoded pixels until the upload.
+        int                        width      = 0;                  ///< Decoded width.
+        int                        height     = 0;                  ///< Decoded height.
+        ImTextureID                texture    = ImTextureID();      ///< Uploaded texture.
+    };
+
+    /// \brief One decode request (shared with the workers).
+    struct DecodeJob {
+        ImGuiID      id;
+        unsigned int generation;
+        std::string  key;
+    };
+
+    /// \brief One decode result (shared with the workers).
+    struct DecodeResult {
+        ImGuiID                    id         = 0;
+        unsigned int               generation = 0;
+        bool                       ok         = false;
+        std::vector<unsigned char> rgba;
+        int                        width      = 0;
+        int                        height     = 0;
+    };
+
+    /// \brief One decoded icon waiting for its upload: the generation tells entries of colliding keys apart.
+    struct UploadRef {
+        ImGuiID      id;
+        unsigned int generation;
+    };
+
+    typedef std::list<IconEntry> IconList;
+
+};  // namespace
+
+struct ImCoolBarIconProviderImpl {
+    ImCoolBarIconProviderConfig config;
+
+    // UI thread
+    IconList                                             lru;      ///< Most recently drawn first.
+    std::unordered_multimap<ImGuiID, IconList::iterator> entries;  ///< Key hash -> entries (one per key).
+    std::deque<UploadRef>                                uploads;  ///< Decoded icons in decode order.
+    std::vector<DecodeResult>                            results_ui;
+    unsigned int                                         next_generation = 0;
+    int                                                  uploads_count   = 0;
+    int                                                  evictions_count = 0;
+    bool                                                 released        = false;  ///< Invalidate() released a texture since the last Update().
+
+    // Shared with the workers
+    std::mutex                mutex;
+    std::condition_variable   cv;
+    std::deque<DecodeJob>     jobs;
+    std::vector<DecodeResult> results;
+    bool                      stopping = false;
+    std::vector<std::thread>  workers;
+
+    void workerLoop() {
+        for (;;) {
+            DecodeJob job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [this]() { return stopping || !jobs.empty(); });
+                if (stopping) {
+                    return;
+                }
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            DecodeResult result;
+            result.id         = job.id;
+            result.generation = job.generation;
+            result.ok = config.decode(job.key.c_str(), result.rgba, result.width, result.height, config.user_data) &&  //
+                        result.width > 0 && result.height > 0 && result.rgba.size() >= (size_t)result.width * (size_t)result.height * 4u;
+            std::lock_guard<std::mutex> lock(mutex);
+            results.push_back(std::move(result));
+        }
+    }
+
+    // Entry of a key; colliding hashes are told apart by the key itself (no allocation)
+    IconList::iterator findEntry(const ImGuiID vId, const char* vKey) {
+        const auto range = entries.equal_range(vId);
+        for (auto found = range.first; found != range.second; ++found) {
+            if (found->second->key == vKey) {
+                return found->second;
+            }
+        }
+        return lru.end();
+    }
+
+    // Entry that made a decode request; generations are unique, so colliding keys cannot take each other's pixels
+    IconList::iterator findEntry(const ImGuiID vId, const unsigned int vGeneration) {
+        const auto range = entries.equal_range(vId);
+        for (auto found = range.first; found != range.second; ++found) {
+            if (found->second->generation == vGeneration) {
+                return found->second;
+            }
+        }
+        return lru.end();
+    }
+
+    void releaseEntry(IconEntry& vEntry) {
+        if (vEntry.state == IconState_Ready && config.release != nullptr) {
+            config.release(vEntry.texture, config.user_data);
+        }
+        vEntry.texture = ImTextureID();
+        vEntry.state   = IconState_Failed;
+    }
+
+    void eraseEntry(const IconList::iterator& vIt) {
+        releaseEntry(*vIt);
+        const auto range = entries.equal_range(vIt->id);
+        for (auto found = range.first; found != range.second; ++found) {
+            if (found->second == vIt) {
+                entries.erase(found);
+                break;
+            }
+        }
+        lru.erase(vIt);
+    }
+};
+
+ImCoolBarIconProvider::ImCoolBarIconProvider(const ImCoolBarIconProviderConfig& vConfig) : m_impl(new ImCoolBarIconProviderImpl()) {
+    IM_ASSERT(vConfig.decode != nullptr && vConfig.upload != nullptr);
+    m_impl->config = vConfig;
+    const int workers_count = ImMax(vConfig.workers_count, 1);
+    for (int i = 0; i < workers_count; ++i) {
+        m_impl->workers.emplace_back(&ImCoolBarIconProviderImpl::workerLoop, m_impl);
+    }
+}
+
+ImCoolBarIconProvider::~ImCoolBarIconProvider() {
+    {
+        std::lock_guard<std::mutex> lock(m_impl->mutex);
+        m_impl->stopping = true;
+    }
+    m_impl->cv.notify_all();
+    for (std::thread& worker : m_impl->workers) {
+        worker.join();
+    }
+    for (IconEntry& entry : m_impl->lru) {
+        m_impl->releaseEntry(entry);
+    }
+    delete m_impl;
+}
+
+bool ImCoolBarIconProvider::GetTexture(const char* vKey, ImTextureID* vOutTexture) {
+    ImCoolBarIconProviderImpl& impl = *m_impl;
+    const ImGuiID id = ImHashData(vKey, strlen(vKey));
+    const IconList::iterator it = impl.findEntry(id, vKey);
+    if (it != impl.lru.end()) {
+        if (it != impl.lru.begin()) {
+            impl.lru.splice(impl.lru.begin(), impl.lru, it); // touch: no allocation
+        }
+        if (it->state != IconState_Ready) {
+            return false;
+        }
+        if (vOutTexture != nullptr) {
+            *vOutTexture = it->texture;
+        }
+        return true;
+    }
+
+    // First request: the entry is pinned in the cache until its decode comes back
+    IconEntry entry;
+    entry.id         = id;
+    entry.key        = vKey;
+    entry.generation = ++impl.next_generation;
+    impl.lru.push_front(std::move(entry));
+    impl.entries.emplace(id, impl.lru.begin());
+    {
+        std::lock_guard<std::mutex> lock(impl.mutex);
+        impl.jobs.push_back({id, impl.next_generation, std::string(vKey)});
+    }
+    impl.cv.notify_one();
+    return false;
+}
+
+bool ImCoolBarIconProvider::Update() {
+    ImCoolBarIconProviderImpl& impl = *m_impl;
+    bool changed = impl.released;
+    impl.released = false;
+
+    // Collect the decodes; results of evicted or invalidated requests are dropped
+    impl.results_ui.clear();
+    {
+        std::lock_guard<std::mutex> lock(impl.mutex);
+        impl.results_ui.swap(impl.results);
+    }
+    for (DecodeResult& result : impl.results_ui) {
+        const IconList::iterator found = impl.findEntry(result.id, result.generation);
+        if (found == impl.lru.end()) {
+            continue;
+        }
+        IconEntry& entry = *found;
+        if (entry.state != IconState_Pending) {
+            continue;
+        }
+        if (result.ok) {
+            entry.state  = IconState_Decoded;
+            entry.width  = result.width;
+            entry.height = result.height;
+            entry.rgba.swap(result.rgba);
+            impl.uploads.push_back({entry.id, entry.generation});
+        } else {
+            entry.state = IconState_Failed;
+        }
+    }
+
+    // Upload a few per frame so a full dock does not create all its textures in one frame
+    int budget = ImMax(impl.config.uploads_per_frame, 1);
+    while (budget > 0 && !impl.uploads.empty()) {
+        const UploadRef upload = impl.uploads.front();
+        impl.uploads.pop_front();
+        const IconList::iterator found = impl.findEntry(upload.id, upload.generation);
+        if (found == impl.lru.end() || found->state != IconState_Decoded) {
+            continue;
+        }
+        IconEntry& entry = *found;
+        entry.texture = impl.config.upload(entry.rgba.data(), entry.width, entry.height, impl.config.user_data);
+        entry.state   = entry.texture != ImTextureID() ? IconState_Ready : IconState_Failed;
+        std::vector<unsigned char>().swap(entry.rgba); // the texture owns the pixels now
+        ++impl.uploads_count;
+        --budget;
+        changed = true;
+    }
+
+    // Evict the least recently drawn icons; pending ones stay until their decode comes back
+    IconList::iterator it = impl.lru.end();
+    while ((int)impl.entries.size() > ImMax(impl.config.cache_capacity, 0) && it != impl.lru.begin()) {
+        --it;
+        if (it->state == IconState_Pending) {
+            continue;
+        }
+        const bool was_ready = it->state == IconState_Ready;
+        impl.eraseEntry(it++);
+        ++impl.evictions_count;
+        changed |= was_ready;
+    }
+    return changed;
+}
+
+bool ImCoolBarIconProvider::Invalidate(const char* vKey) {
+    const IconList::iterator found = m_impl->findEntry(ImHashData(vKey, strlen(vKey)), vKey);
+    if (found == m_impl->lru.end()) {
+        return false;
+    }
+    const bool was_ready = found->state == IconState_Ready;
+    m_impl->eraseEntry(found);
+    m_impl->released |= was_ready;
+    return was_ready;
+}
+
+ImCoolBarIconProviderStats ImCoolBarIconProvider::GetStats() const {
+    ImCoolBarIconProviderStats stats;
+    for (const IconEntry& entry : m_impl->lru) {
+        switch (entry.state) {
+            case IconState_Pending: ++stats.pending; break;
+            case IconState_Decoded: ++stats.decoded; break;
+            case IconState_Ready: ++stats.ready; break;
+            case IconState_Failed: ++stats.failed; break;
+        }
+    }
+    stats.cached    = (int)m_impl->entries.size();
+    stats.uploads   = m_impl->uploads_count;
+    stats.evictions = m_impl->evictions_count;
+    return stats;
+}
+
+IMGUI_API bool ImGui::CoolBarProviderIcon(ImCoolBarIconProvider& vProvider, const char* vKey, ImTextureID vPlaceholder, const ImVec4& vTintCol) {
+    ImTextureID texture = vPlaceholder;
+    vProvider.GetTexture(vKey, &texture);
+    return ImGui::CoolBarIcon(texture, ImVec2(0.0f, 0.0f), ImVec2(1.0f, 1.0f), vTintCol);
+}
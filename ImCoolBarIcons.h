@@ -0,0 +1,134 @@
+/*
+MIT License
+
+Copyright (c) 2025 NewYaroslav
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Optional asynchronous icon provider for CoolBar docks: images are decoded on worker threads,
+// uploaded by the host on the UI thread and drawn with a placeholder until they are ready.
+
+#pragma once
+
+#include "ImCoolBar.h"
+#include <vector>
+
+/// \brief Decode one icon into RGBA8 pixels. Called on a worker thread: must be thread-safe.
+/// \param vKey Icon key passed to \c ImCoolBarIconProvider::GetTexture().
+/// \param vOutRgba Receives width * height * 4 bytes.
+/// \param vOutWidth Receives the width in pixels.
+/// \param vOutHeight Receives the height in pixels.
+/// \param vUserData \c ImCoolBarIconProviderConfig::user_data.
+/// \return \c false if the icon cannot be decoded (the placeholder stays).
+typedef bool (*ImCoolBarIconDecodeFn)(const char* vKey, std::vector<unsigned char>& vOutRgba, int& vOutWidth, int& vOutHeight, void* vUserData);
+
+/// \brief Create a texture from decoded pixels. Called on the UI thread from \c ImCoolBarIconProvider::Update().
+/// \return The texture, or \c ImTextureID() if the upload failed (the placeholder stays).
+typedef ImTextureID (*ImCoolBarIconUploadFn)(const unsigned char* vRgba, int vWidth, int vHeight, void* vUserData);
+
+/// \brief Destroy a texture evicted from the cache or owned by a destroyed provider. Called on the UI thread.
+typedef void (*ImCoolBarIconReleaseFn)(ImTextureID vTexture, void* vUserData);
+
+/// \brief Callbacks and limits of an \c ImCoolBarIconProvider.
+struct ImCoolBarIconProviderConfig {
+    ImCoolBarIconDecodeFn  decode            = nullptr;  ///< Decoder (required).
+    ImCoolBarIconUploadFn  upload            = nullptr;  ///< Texture upload (required).
+    ImCoolBarIconReleaseFn release           = nullptr;  ///< Texture release (optional).
+    void*                  user_data         = nullptr;  ///< Passed to every callback.
+    int                    workers_count     = 2;        ///< Decoding threads.
+    int                    cache_capacity    = 256;      ///< Icons kept; the least recently drawn ones are evicted beyond it.
+    int                    uploads_per_frame = 4;        ///< Uploads per \c Update() call, spreads texture creation over frames.
+};
+
+/// \brief Counters of an \c ImCoolBarIconProvider.
+struct ImCoolBarIconProviderStats {
+    int cached    = 0;  ///< Icons in the cache (any state).
+    int pending   = 0;  ///< Icons queued or being decoded.
+    int decoded   = 0;  ///< Icons decoded and waiting for an upload.
+    int ready     = 0;  ///< Icons with a texture.
+    int failed    = 0;  ///< Icons whose decode or upload failed.
+    int uploads   = 0;  ///< Uploads since creation.
+    int evictions = 0;  ///< Icons evicted since creation.
+};
+
+struct ImCoolBarIconProviderImpl;
+
+/// \brief Asynchronous icon decode pipeline with an LRU texture cache.
+/// \details \c GetTexture() only looks the key up and queues a decode the first time a key is seen;
+/// workers decode into pixel buffers and \c Update() hands at most \c uploads_per_frame of them
+/// to the upload callback. Use from the UI thread only (the callbacks document their thread).
+/// \code
+/// ImCoolBarIconProvider icons(cfg);
+/// // each frame, before the bars:
+/// icons.Update();
+/// if (ImGui::BeginCoolBar("##Dock", ImCoolBarFlags_Horizontal)) {
+///     for (const Document& doc : docs)
+///         if (ImGui::CoolBarProviderIcon(icons, doc.path.c_str(), placeholder_tex))
+///             Open(doc);
+///     ImGui::EndCoolBar();
+/// }
+/// \endcode
+class ImCoolBarIconProvider {
+public:
+    /// \brief Start the worker threads.
+    /// \param vConfig Callbacks and limits (\c decode and \c upload are required).
+    explicit ImCoolBarIconProvider(const ImCoolBarIconProviderConfig& vConfig);
+
+    /// \brief Stop the workers (queued decodes are dropped) and release every texture.
+    ~ImCoolBarIconProvider();
+
+    /// \brief Get the texture of an icon, queueing its decode the first time the key is seen.
+    /// \param vKey Icon key passed to the decoder (path, URL, document id...).
+    /// \param vOutTexture Receives the texture when ready.
+    /// \return \c true if the texture is ready, \c false while the placeholder should be shown.
+    bool GetTexture(const char* vKey, ImTextureID* vOutTexture);
+
+    /// \brief Upload decoded icons and evict the least recently used ones. Call once per frame.
+    /// \return \c true when an icon texture appeared, was evicted or was released by \c Invalidate(): bars using
+    /// \c cache_static_geometry should call \c ImGui::InvalidateCoolBarCache().
+    bool Update();
+
+    /// \brief Drop an icon (its texture is released); the next \c GetTexture() decodes it again.
+    /// \param vKey Icon key.
+    /// \return \c true if a ready texture was released: bars using \c cache_static_geometry still reference it and
+    /// should call \c ImGui::InvalidateCoolBarCache() (the next \c Update() returns \c true as well).
+    bool Invalidate(const char* vKey);
+
+    /// \brief Get the provider counters.
+    ImCoolBarIconProviderStats GetStats() const;
+
+private:
+    ImCoolBarIconProvider(const ImCoolBarIconProvider&);
+    ImCoolBarIconProvider& operator=(const ImCoolBarIconProvider&);
+
+    ImCoolBarIconProviderImpl* m_impl;
+};
+
+namespace ImGui {
+
+/// \brief \c CoolBarIcon() showing an icon of \c vProvider, or \c vPlaceholder until it is ready.
+/// \param vProvider Icon provider.
+/// \param vKey Icon key.
+/// \param vPlaceholder Texture drawn while the icon is decoded (full UV range).
+/// \param vTintCol Tint color.
+/// \return \c true if the icon was clicked this frame.
+IMGUI_API bool CoolBarProviderIcon(ImCoolBarIconProvider& vProvider, const char* vKey, ImTextureID vPlaceholder, const ImVec4& vTintCol = ImVec4(1.0f, 1.0f, 1.0f, 1.0f));
+
+}  // namespace ImGui
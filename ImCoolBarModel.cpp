@@ -0,0 +1,176 @@
+/*
+MIT License
+
+Copyright (c) 2025 NewYaroslav
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "ImCoolBarModel.h"
+#include "imgui_internal.h"
+
+ImCoolBarModel::ImCoolBarModel(const char* vLabel, ImCoolBarFlags vCBFlags, const ImCoolBarConfig& vConfig)
+    : m_flags(vCBFlags), m_config(vConfig), m_drawFn(nullptr), m_userData(nullptr), m_indexDirty(false), m_changed(true) {
+    IM_ASSERT(vLabel != nullptr);
+    m_label.resize((int)strlen(vLabel) + 1);
+    memcpy(m_label.Data, vLabel, (size_t)m_label.Size);
+}
+
+void ImCoolBarModel::SetConfig(const ImCoolBarConfig& vConfig) {
+    m_config = vConfig;
+    markChanged(); // not every config field is part of the static frame key
+}
+
+void ImCoolBarModel::SetDrawCallback(ImCoolBarModelDrawFn vDrawFn, void* vUserData) {
+    m_drawFn   = vDrawFn;
+    m_userData = vUserData;
+    markChanged();
+}
+
+// Positions are stored + 1 so that 0 (the storage default) means absent. Insertions and removals only
+// mark the index dirty: a batch of edits costs one rebuild at the next lookup.
+void ImCoolBarModel::rebuildIndex() const {
+    m_index.Data.resize(0);
+    m_index.Data.reserve(m_ids.Size);
+    for (int i = 0; i < m_ids.Size; ++i) {
+        m_index.Data.push_back(ImGuiStoragePair(m_ids[i], i + 1));
+    }
+    m_index.BuildSortByKey();
+    m_indexDirty = false;
+}
+
+void ImCoolBarModel::markChanged() {
+    m_changed = true;
+}
+
+int ImCoolBarModel::FindItem(ImGuiID vId) const {
+    if (m_indexDirty) {
+        rebuildIndex();
+    }
+    return m_index.GetInt(vId, 0) - 1;
+}
+
+void* ImCoolBarModel::GetItemPayload(ImGuiID vId) const {
+    const int idx = FindItem(vId);
+    return idx >= 0 ? m_payloads[idx] : nullptr;
+}
+
+bool ImCoolBarModel::AddItem(ImGuiID vId, void* vPayload, int vIndex) {
+    if (FindItem(vId) >= 0) {
+        return false;
+    }
+    if (vIndex < 0 || vIndex >= m_ids.Size) {
+        m_ids.push_back(vId);
+        m_payloads.push_back(vPayload);
+        if (!m_indexDirty) {
+            m_index.SetInt(vId, m_ids.Size);
+        }
+    } else {
+        m_ids.insert(m_ids.Data + vIndex, vId);
+        m_payloads.insert(m_payloads.Data + vIndex, vPayload);
+        m_indexDirty = true;
+    }
+    markChanged();
+    return true;
+}
+
+bool ImCoolBarModel::RemoveItem(ImGuiID vId) {
+    const int idx = FindItem(vId);
+    if (idx < 0) {
+        return false;
+    }
+    m_ids.erase(m_ids.Data + idx);
+    m_payloads.erase(m_payloads.Data + idx);
+    m_indexDirty = true;
+    markChanged();
+    return true;
+}
+
+bool ImCoolBarModel::MoveItem(ImGuiID vId, int vIndex) {
+    const int idx = FindItem(vId);
+    if (idx < 0) {
+        return false;
+    }
+    void* payload = m_payloads[idx];
+    m_ids.erase(m_ids.Data + idx);
+    m_payloads.erase(m_payloads.Data + idx);
+    vIndex = ImClamp(vIndex, 0, m_ids.Size);
+    m_ids.insert(m_ids.Data + vIndex, vId);
+    m_payloads.insert(m_payloads.Data + vIndex, payload);
+    m_indexDirty = true;
+    markChanged();
+    return true;
+}
+
+bool ImCoolBarModel::SetItemPayload(ImGuiID vId, void* vPayload) {
+    const int idx = FindItem(vId);
+    if (idx < 0) {
+        return false;
+    }
+    m_payloads[idx] = vPayload;
+    markChanged();
+    return true;
+}
+
+bool ImCoolBarModel::MarkItemDirty(ImGuiID vId) {
+    if (FindItem(vId) < 0) {
+        return false;
+    }
+    markChanged();
+    return true;
+}
+
+void ImCoolBarModel::Clear() {
+    m_ids.resize(0);
+    m_payloads.resize(0);
+    m_index.Clear();
+    m_indexDirty = false;
+    markChanged();
+}
+
+ImGuiID ImCoolBarModel::Draw() {
+    IM_ASSERT(m_drawFn != nullptr && "ImCoolBarModel::SetDrawCallback() was not called");
+    const char* label = m_label.Data;
+    if (m_changed) {
+        ImGui::InvalidateCoolBarCache(label);
+        m_changed = false;
+    }
+    ImCoolBarConfig config = m_config;
+    config.cache_static_geometry = true; // every change above invalidates the retained frame
+    ImGui::SetNextCoolBarItemsCount(m_ids.Size);
+
+    ImGuiID clicked = 0;
+    if (ImGui::BeginCoolBar(label, m_flags, config)) {
+        ImCoolBarClipper clipper;
+        clipper.Begin(m_ids.Size);
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                if (ImGui::CoolBarItem()) {
+                    ImGui::PushID((int)m_ids[i]);
+                    if (m_drawFn(m_ids[i], m_payloads[i], ImGui::GetCoolBarItemWidth(), m_userData)) {
+                        clicked = m_ids[i];
+                    }
+                    ImGui::PopID();
+                }
+            }
+        }
+        ImGui::EndCoolBar();
+    }
+    return clicked;
+}
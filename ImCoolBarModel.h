@@ -0,0 +1,125 @@
+/*
+MIT License
+
+Copyright (c) 2025 NewYaroslav
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Optional retained CoolBar: items are added and removed with stable IDs and drawn by one call.
+// The model knows when its items change, so idle frames replay the bar's retained geometry.
+
+#pragma once
+
+#include "ImCoolBar.h"
+
+/// \brief Draw the content of one model item, between \c CoolBarItem() and the next item.
+/// \param vId Stable item ID (also pushed on the ImGui ID stack).
+/// \param vPayload Payload passed to \c ImCoolBarModel::AddItem().
+/// \param vSize Current item size (\c GetCoolBarItemWidth()).
+/// \param vUserData User data passed to \c ImCoolBarModel::SetDrawCallback().
+/// \return \c true if the item was clicked.
+typedef bool (*ImCoolBarModelDrawFn)(ImGuiID vId, void* vPayload, float vSize, void* vUserData);
+
+/// \brief Retained CoolBar: a list of items with stable IDs and payloads, drawn by \c Draw().
+/// \details \c Draw() submits the bar through \c ImCoolBarClipper, so only the items that can be visible
+/// (plus the bubble's reach) are laid out and drawn, and with \c cache_static_geometry forced on: an idle
+/// bar replays its retained geometry without calling the draw callback. The geometry is retained per bar:
+/// adding, removing, moving or dirtying any item drops it, and the next \c Draw() redraws every visible
+/// item once. The draw callback must only depend on the item and its payload, call \c MarkItemDirty()
+/// when what it draws changes.
+/// \code
+/// ImCoolBarModel dock("##Dock", ImCoolBarFlags_Horizontal, cfg);
+/// dock.SetDrawCallback(drawApp, nullptr);
+/// for (App& app : apps)
+///     dock.AddItem(ImHashStr(app.name), &app);
+/// // each frame:
+/// if (ImGuiID clicked = dock.Draw())
+///     Launch(clicked);
+/// \endcode
+class ImCoolBarModel {
+public:
+    /// \param vLabel Window label of the bar (copied).
+    /// \param vCBFlags Orientation flags.
+    /// \param vConfig Configuration settings.
+    ImCoolBarModel(const char* vLabel, ImCoolBarFlags vCBFlags = ImCoolBarFlags_Horizontal, const ImCoolBarConfig& vConfig = {});
+
+    /// \brief Replace the bar configuration (the whole bar is redrawn once).
+    void SetConfig(const ImCoolBarConfig& vConfig);
+
+    /// \brief Set the function drawing each item (required before \c Draw()).
+    void SetDrawCallback(ImCoolBarModelDrawFn vDrawFn, void* vUserData);
+
+    /// \brief Insert an item.
+    /// \param vId Stable ID, unique within the model.
+    /// \param vPayload User pointer handed to the draw callback.
+    /// \param vIndex Position of the item (-1 = at the end).
+    /// \return \c false if \c vId is already in the model.
+    bool AddItem(ImGuiID vId, void* vPayload = nullptr, int vIndex = -1);
+
+    /// \brief Remove an item.
+    /// \return \c false if \c vId is not in the model.
+    bool RemoveItem(ImGuiID vId);
+
+    /// \brief Move an item to another position.
+    /// \return \c false if \c vId is not in the model.
+    bool MoveItem(ImGuiID vId, int vIndex);
+
+    /// \brief Replace the payload of an item and invalidate the bar's retained geometry (the whole bar is redrawn once).
+    /// \return \c false if \c vId is not in the model.
+    bool SetItemPayload(ImGuiID vId, void* vPayload);
+
+    /// \brief Invalidate the bar's retained geometry after an item's content changed (the whole bar is redrawn once).
+    /// \return \c false if \c vId is not in the model.
+    bool MarkItemDirty(ImGuiID vId);
+
+    /// \brief Remove every item.
+    void Clear();
+
+    /// \brief Get the position of an item, or -1.
+    int FindItem(ImGuiID vId) const;
+
+    /// \brief Get the payload of an item, or \c nullptr.
+    void* GetItemPayload(ImGuiID vId) const;
+
+    /// \brief Get the number of items.
+    int GetItemsCount() const { return m_ids.Size; }
+
+    /// \brief Get the ID of the item at a position.
+    ImGuiID GetItemId(int vIndex) const { return m_ids[vIndex]; }
+
+    /// \brief Draw the bar. Call once per frame.
+    /// \return ID of the item clicked this frame, or 0.
+    ImGuiID Draw();
+
+private:
+    void rebuildIndex() const;
+    void markChanged();
+
+    ImVector<char>       m_label;           ///< Window label, null-terminated.
+    ImCoolBarFlags       m_flags;           ///< Orientation flags.
+    ImCoolBarConfig      m_config;          ///< Bar configuration.
+    ImCoolBarModelDrawFn m_drawFn;          ///< Item draw callback.
+    void*                m_userData;        ///< Passed to \c m_drawFn.
+    ImVector<ImGuiID>    m_ids;             ///< Item IDs in display order.
+    ImVector<void*>      m_payloads;        ///< Item payloads, indexed like \c m_ids.
+    mutable ImGuiStorage m_index;           ///< Item ID -> position + 1 (0 = absent).
+    mutable bool         m_indexDirty;      ///< Positions moved: rebuild \c m_index on the next lookup.
+    bool                 m_changed;         ///< Items changed since the last \c Draw(): drop the retained geometry.
+};
@@ -0,0 +1,1035 @@
+/*
+MIT License
+
+Copyright (c) 2025 NewYaroslav
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// ImCoolBar benchmarks, run on a headless ImGui context (no renderer backend).
+// Usage: ImCoolBar_bench [kernel|frames|layout_mt|policy|budget|alloc|icons|model|all] [--json <file>]
+//                        [--budgets <file>] [--write-budgets <file>]
+
+#include "ImCoolBar.h"
+#include "ImCoolBarIcons.h"
+#include "ImCoolBarModel.h"
+#include "imgui_internal.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    typedef std::chrono::steady_clock Clock;
+
+    static double elapsedNs(const Clock::time_point& vStart) {
+        return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - vStart).count();
+    }
+
+    // Reference: the per-item curve CoolBarItem() used before the batch kernel
+    static float bubbleEffectRef(const float vValue, const float vStength) {
+        return pow(cos(vValue * 3.14159265358979323846f * vStength), 12.0f);
+    }
+
+    static float getHoverSizeRef(const float vValue, const float vNormalSize, const float vHoveredSize, const float vStength, const float vScale) {
+        const float v = vNormalSize + (vHoveredSize - vNormalSize) * bubbleEffectRef(vValue, vStength) * vScale;
+        return v < vNormalSize ? vNormalSize : (v > vHoveredSize ? vHoveredSize : v);
+    }
+
+    static volatile float s_sink = 0.0f; // keeps results alive
+
+    static void benchKernel() {
+        const float normal_size  = 40.0f;
+        const float hovered_size = 60.0f;
+        const float strength     = 0.5f;
+        const float anim_scale   = 1.0f;
+        const int   counts[]     = {10, 100, 10000};
+
+        printf("%-8s %14s %14s %10s %12s\n", "items", "scalar ns/it", "batch ns/it", "speedup", "max err px");
+        for (const int count : counts) {
+            std::vector<float> centers(count);
+            std::vector<float> sizes_ref(count);
+            std::vector<float> sizes_batch(count);
+            for (int i = 0; i < count; ++i) {
+                centers[i] = 20.0f + (float)i * (normal_size + 8.0f);
+            }
+            const float extent = centers.back() + 20.0f;
+            const float mouse  = extent * 0.37f;
+            const int   iters  = std::max(1, 2000000 / count);
+
+            Clock::time_point start = Clock::now();
+            for (int it = 0; it < iters; ++it) {
+                const float m = mouse + (float)(it & 15);
+                for (int i = 0; i < count; ++i) {
+                    sizes_ref[i] = getHoverSizeRef((m - centers[i]) / extent, normal_size, hovered_size, strength, anim_scale);
+                }
+                s_sink = s_sink + sizes_ref[it % count];
+            }
+            const double scalar_ns = elapsedNs(start) / ((double)iters * count);
+
+            start = Clock::now();
+            for (int it = 0; it < iters; ++it) {
+                const float m = mouse + (float)(it & 15);
+                ImGui::CoolBarBubbleSizes(centers.data(), sizes_batch.data(), count, m, extent, normal_size, hovered_size, strength, anim_scale);
+                s_sink = s_sink + sizes_batch[it % count];
+            }
+            const double batch_ns = elapsedNs(start) / ((double)iters * count);
+
+            const float m = mouse + (float)((iters - 1) & 15);
+            float max_err = 0.0f;
+            for (int i = 0; i < count; ++i) {
+                const float ref = getHoverSizeRef((m - centers[i]) / extent, normal_size, hovered_size, strength, anim_scale);
+                max_err = std::max(max_err, fabsf(ref - sizes_batch[i]));
+            }
+            printf("%-8d %14.2f %14.2f %9.2fx %12.6f\n", count, scalar_ns, batch_ns, scalar_ns / batch_ns, max_err);
+        }
+    }
+
+    /// \brief One cell of the frame benchmark matrix.
+    struct FrameScenario {
+        int  bars;
+        int  items;
+        bool horizontal;
+        bool smoothing;
+        bool hovered;
+        bool cached;
+        bool templated;
+    };
+
+    /// \brief Measured cost of one scenario.
+    struct FrameResult {
+        FrameScenario scenario;
+        int           frames;
+        double        ns_per_frame;
+        double        ns_per_item;
+    };
+
+    static std::string scenarioName(const FrameScenario& vScenario) {
+        char buf[128];
+        snprintf(buf, sizeof(buf), "bars%d_items%d_%s_%s_%s%s", vScenario.bars, vScenario.items, vScenario.horizontal ? "h" : "v",
+                 vScenario.smoothing ? "smooth" : "step", vScenario.hovered ? "hovered" : "idle", vScenario.cached ? "_cached" : "");
+        return buf;
+    }
+
+    /// \brief Headless ImGui context: fonts are built on the CPU, nothing is rendered.
+    struct HeadlessContext {
+        ImGuiContext* ctx = nullptr;
+
+        HeadlessContext() {
+            ctx = ImGui::CreateContext();
+            ImGuiIO& io      = ImGui::GetIO();
+            io.IniFilename   = nullptr;
+            io.LogFilename   = nullptr;
+            io.DisplaySize   = ImVec2(1920.0f, 1080.0f);
+            io.DeltaTime     = 1.0f / 60.0f;
+            unsigned char* pixels = nullptr;
+            int width = 0, height = 0;
+            io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+        }
+
+        ~HeadlessContext() {
+            ImGui::DestroyContext(ctx);
+        }
+    };
+
+    template <ImCoolBarFlags TFlags>
+    static void submitBarsTemplated(const FrameScenario& vScenario, const std::vector<std::string>& vLabels, const ImCoolBarConfig* vConfigs) {
+        for (int b = 0; b < vScenario.bars; ++b) {
+            if (ImGui::BeginCoolBar<TFlags>(vLabels[b].c_str(), vConfigs[b])) {
+                for (int i = 0; i < vScenario.items; ++i) {
+                    if (ImGui::CoolBarItem<TFlags>()) {
+                        const float w = ImGui::GetCoolBarItemWidth();
+                        ImGui::Dummy(ImVec2(w, w));
+                    }
+                }
+                ImGui::EndCoolBar();
+            }
+        }
+    }
+
+    static void submitBars(const FrameScenario& vScenario, const std::vector<std::string>& vLabels, const ImCoolBarConfig* vConfigs) {
+        if (vScenario.templated) {
+            if (vScenario.horizontal) {
+                submitBarsTemplated<ImCoolBarFlags_Horizontal>(vScenario, vLabels, vConfigs);
+            } else {
+                submitBarsTemplated<ImCoolBarFlags_Vertical>(vScenario, vLabels, vConfigs);
+            }
+            return;
+        }
+        const ImCoolBarFlags flags = vScenario.horizontal ? ImCoolBarFlags_Horizontal : ImCoolBarFlags_Vertical;
+        for (int b = 0; b < vScenario.bars; ++b) {
+            if (ImGui::BeginCoolBar(vLabels[b].c_str(), flags, vConfigs[b])) {
+                for (int i = 0; i < vScenario.items; ++i) {
+                    if (ImGui::CoolBarItem()) {
+                        const float w = ImGui::GetCoolBarItemWidth();
+                        ImGui::Dummy(ImVec2(w, w));
+                    }
+                }
+                ImGui::EndCoolBar();
+            }
+        }
+    }
+
+    static FrameResult runFrameScenario(const FrameScenario& vScenario) {
+        HeadlessContext headless;
+        ImGuiIO& io = ImGui::GetIO();
+
+        std::vector<std::string> labels(vScenario.bars);
+        std::vector<ImCoolBarConfig> configs(vScenario.bars);
+        for (int b = 0; b < vScenario.bars; ++b) {
+            char buf[32];
+            snprintf(buf, sizeof(buf), "##bench_bar_%d", b);
+            labels[b] = buf;
+            // Spread the bars along the cross axis so that only one can be hovered
+            const float cross = ((float)b + 0.5f) / (float)vScenario.bars;
+            configs[b].anchor = vScenario.horizontal ? ImVec2(0.5f, cross) : ImVec2(cross, 0.5f);
+            configs[b].cache_static_geometry = vScenario.cached;
+            if (!vScenario.smoothing) {
+                configs[b].mouse_smoothing_ms = 0.0f;
+                configs[b].anim_smoothing_ms  = 0.0f;
+            }
+        }
+
+        const int warmup_frames = 10;
+        const long long total_items = (long long)vScenario.bars * vScenario.items;
+        const int frames = (int)std::min<long long>(300, std::max<long long>(10, 4000000LL / total_items));
+        double total_ns = 0.0;
+        for (int frame = 0; frame < warmup_frames + frames; ++frame) {
+            // Scripted mouse: sweep along the first bar, or park it in a corner
+            ImVec2 mouse(1.0f, 1.0f);
+            if (vScenario.hovered) {
+                if (ImGuiWindow* window_ptr = ImGui::FindWindowByName(labels[0].c_str())) {
+                    const ImRect rect = window_ptr->Rect();
+                    const float t = 0.5f + 0.45f * sinf((float)frame * 0.05f);
+                    mouse = vScenario.horizontal ? ImVec2(ImLerp(rect.Min.x, rect.Max.x, t), (rect.Min.y + rect.Max.y) * 0.5f)
+                                                 : ImVec2((rect.Min.x + rect.Max.x) * 0.5f, ImLerp(rect.Min.y, rect.Max.y, t));
+                }
+            }
+            io.AddMousePosEvent(mouse.x, mouse.y);
+            io.DeltaTime = 1.0f / 60.0f;
+            ImGui::NewFrame();
+            const Clock::time_point start = Clock::now();
+            submitBars(vScenario, labels, configs.data());
+            if (frame >= warmup_frames) {
+                total_ns += elapsedNs(start);
+            }
+            ImGui::Render();
+        }
+
+        FrameResult result;
+        result.scenario     = vScenario;
+        result.frames       = frames;
+        result.ns_per_frame = total_ns / frames;
+        result.ns_per_item  = result.ns_per_frame / (double)total_items;
+        return result;
+    }
+
+    static std::vector<FrameResult> benchFrames() {
+        const int bar_counts[]  = {1, 8, 64};
+        const int item_counts[] = {8, 64, 512, 10000};
+        std::vector<FrameResult> results;
+        printf("%-44s %8s %14s %12s\n", "scenario", "frames", "ns/frame", "ns/item");
+        for (const int bars : bar_counts) {
+            for (const int items : item_counts) {
+                if ((long long)bars * items > 100000) {
+                    continue; // keeps the matrix within a few seconds
+                }
+                for (int variant = 0; variant < 16; ++variant) {
+                    FrameScenario scenario;
+                    scenario.bars       = bars;
+                    scenario.items      = items;
+                    scenario.horizontal = (variant & 1) != 0;
+                    scenario.smoothing  = (variant & 2) != 0;
+                    scenario.hovered    = (variant & 4) != 0;
+                    scenario.cached     = (variant & 8) != 0;
+                    scenario.templated  = false;
+                    const FrameResult result = runFrameScenario(scenario);
+                    printf("%-44s %8d %14.0f %12.1f\n", scenarioName(scenario).c_str(), result.frames, result.ns_per_frame, result.ns_per_item);
+                    results.push_back(result);
+                }
+            }
+        }
+        return results;
+    }
+
+    // Runtime CoolBarItem() vs CoolBarItem<TFlags>() on the same hovered bars
+    static void benchPolicy() {
+        const int item_counts[] = {64, 512, 10000};
+        printf("%-44s %12s %12s %9s\n", "scenario", "runtime ns", "template ns", "speedup");
+        for (const int items : item_counts) {
+            for (int variant = 0; variant < 2; ++variant) {
+                FrameScenario scenario;
+                scenario.bars       = 1;
+                scenario.items      = items;
+                scenario.horizontal = variant != 0;
+                scenario.smoothing  = true;
+                scenario.hovered    = true;
+                scenario.cached     = false;
+                scenario.templated  = false;
+                const FrameResult runtime = runFrameScenario(scenario);
+                scenario.templated = true;
+                const FrameResult templated = runFrameScenario(scenario);
+                printf("%-44s %12.1f %12.1f %8.2fx\n", scenarioName(scenario).c_str(), runtime.ns_per_item, templated.ns_per_item,
+                       runtime.ns_per_item / templated.ns_per_item);
+            }
+        }
+    }
+
+    /// \brief One layout of the multithread consistency check, with its single-threaded result.
+    struct LayoutCase {
+        ImCoolBarLayoutInput input;
+        std::vector<float>   prev_sizes;
+        std::vector<float>   ref_sizes;
+        std::vector<float>   ref_offsets;
+        float                ref_bar_size;
+        float                ref_main_extent;
+    };
+
+    static void runLayout(const ImCoolBarLayoutInput& vInput, std::vector<float>& vSizes, std::vector<float>& vOffsets, float& vBarSize, float& vMainExtent) {
+        vSizes.resize(vInput.items_count);
+        vOffsets.resize(vInput.items_count);
+        ImCoolBarLayoutOutput output;
+        output.sizes         = vSizes.data();
+        output.cross_offsets = vOffsets.data();
+        ImGui::CoolBarLayout(vInput, output);
+        vBarSize    = output.bar_size;
+        vMainExtent = output.main_extent;
+    }
+
+    static std::vector<LayoutCase> makeLayoutCases() {
+        const int   item_counts[]  = {1, 8, 64, 512, 10000};
+        const float anim_scales[]  = {0.0f, 0.35f, 1.0f};
+        const float strengths[]    = {0.25f, 0.5f, 1.0f};
+        const int   iterations[]   = {0, 8};  // single pass, refined in batches (exact layout)
+        std::vector<LayoutCase> cases;
+        for (const int items : item_counts) {
+            for (const float anim_scale : anim_scales) {
+                for (const float strength : strengths) {
+                    for (const int center_iterations : iterations) {
+                        LayoutCase c;
+                        c.input.items_count       = items;
+                        c.input.item_spacing      = 4.0f;
+                        c.input.start_pos         = 8.0f;
+                        c.input.bar_extent        = (float)items * 44.0f + 16.0f;
+                        c.input.mouse_pos         = c.input.bar_extent * 0.37f;
+                        c.input.anim_scale        = anim_scale;
+                        c.input.effect_strength   = strength;
+                        c.input.anchor            = 0.5f;
+                        c.input.cross_padding     = 8.0f;
+                        c.input.center_iterations = center_iterations;
+                        // Previous frame: the same bar with the mouse slightly behind
+                        std::vector<float> offsets;
+                        c.input.mouse_pos -= 10.0f;
+                        runLayout(c.input, c.prev_sizes, offsets, c.ref_bar_size, c.ref_main_extent);
+                        c.input.mouse_pos += 10.0f;
+                        c.input.prev_sizes = c.prev_sizes.data();
+                        runLayout(c.input, c.ref_sizes, c.ref_offsets, c.ref_bar_size, c.ref_main_extent);
+                        cases.push_back(c);
+                    }
+                }
+            }
+        }
+        for (LayoutCase& c : cases) {
+            c.input.prev_sizes = c.prev_sizes.data(); // vector moves invalidated the pointers
+        }
+        return cases;
+    }
+
+    // CoolBarLayout() must not depend on shared state: every thread recomputes every case in its own
+    // order, without an ImGui context, and must match the single-threaded results bit for bit.
+    static bool benchLayoutMt() {
+        const std::vector<LayoutCase> cases = makeLayoutCases();
+        const int threads_count = (int)std::max(4u, std::thread::hardware_concurrency());
+        const int rounds        = 20;
+        std::atomic<int>       mismatches(0);
+        std::atomic<long long> items_done(0);
+        const Clock::time_point start = Clock::now();
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threads_count; ++t) {
+            threads.emplace_back([&cases, &mismatches, &items_done, t, rounds]() {
+                std::vector<float> sizes, offsets;
+                float bar_size = 0.0f, main_extent = 0.0f;
+                long long items = 0;
+                for (int round = 0; round < rounds; ++round) {
+                    for (size_t n = 0; n < cases.size(); ++n) {
+                        const LayoutCase& c = cases[(n * 7 + (size_t)t + (size_t)round) % cases.size()];
+                        runLayout(c.input, sizes, offsets, bar_size, main_extent);
+                        items += c.input.items_count;
+                        if (memcmp(sizes.data(), c.ref_sizes.data(), sizes.size() * sizeof(float)) != 0 ||
+                            memcmp(offsets.data(), c.ref_offsets.data(), offsets.size() * sizeof(float)) != 0 ||
+                            bar_size != c.ref_bar_size || main_extent != c.ref_main_extent) {
+                            ++mismatches;
+                        }
+                    }
+                }
+                items_done += items;
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        const double ns = elapsedNs(start);
+        printf("layout_mt: %d threads x %d rounds x %d layouts, %d mismatches, %.2f ns/item (wall)\n", threads_count, rounds,
+               (int)cases.size(), mismatches.load(), ns / (double)items_done.load());
+        return mismatches.load() == 0;
+    }
+
+    /// \brief One bar setup of the geometry budget check.
+    struct GeometryScenario {
+        const char* name;
+        bool        horizontal;
+        bool        hovered;
+        bool        antialiasing;    ///< \c ImCoolBarConfig::local_antialiasing.
+        float       rounding;        ///< \c ImCoolBarConfig::frame_rounding_override.
+        bool        icons;           ///< \c CoolBarIcon() items instead of buttons.
+        bool        labels;          ///< A \c CoolBarLabel() under every item.
+        bool        cached;          ///< \c ImCoolBarConfig::cache_static_geometry.
+    };
+
+    /// \brief Geometry of the bar window's draw list (peak over the scripted frames).
+    struct GeometryCounts {
+        int vtx = 0;
+        int idx = 0;
+        int cmd = 0;
+        int covered_labels = 0;  ///< Frames whose last draw command is an icon batch although labels were drawn on the icons.
+    };
+
+    /// \brief Stored budget of one scenario.
+    struct GeometryBudget {
+        std::string    name;
+        GeometryCounts counts;
+    };
+
+    static const GeometryScenario s_geometry_scenarios[] = {
+        // name                     horiz  hover  aa     round  icons  labels cached
+        {"buttons_h_idle",          true,  false, true,  -1.0f, false, false, false},
+        {"buttons_h_hovered",       true,  true,  true,  -1.0f, false, false, false},
+        {"buttons_v_hovered",       false, true,  true,  -1.0f, false, false, false},
+        {"buttons_h_hovered_noaa",  true,  true,  false, -1.0f, false, false, false},
+        {"buttons_h_hovered_round", true,  true,  true,  6.0f,  false, false, false},
+        {"buttons_h_idle_cached",   true,  false, true,  6.0f,  false, false, true},
+        {"icons_h_hovered",         true,  true,  true,  -1.0f, true,  false, false},
+        {"labels_h_hovered",        true,  true,  true,  6.0f,  false, true,  false},
+        {"icons_labels_v_hovered",  false, true,  true,  -1.0f, true,  true,  false},
+    };
+
+    // Runs a bar of 8 items with a scripted mouse and records the bar window's draw list after Render()
+    static GeometryCounts runGeometryScenario(const GeometryScenario& vScenario) {
+        HeadlessContext headless;
+        ImGuiIO& io = ImGui::GetIO();
+        const char* bar_label = "##budget_bar";
+        const char* item_labels[] = {"A", "B", "C", "D", "E", "F", "G", "H"};
+        ImCoolBarConfig config;
+        config.anchor                  = vScenario.horizontal ? ImVec2(0.5f, 1.0f) : ImVec2(0.0f, 0.5f);
+        config.local_antialiasing      = vScenario.antialiasing;
+        config.frame_rounding_override = vScenario.rounding;
+        config.cache_static_geometry   = vScenario.cached;
+        const ImCoolBarFlags flags     = vScenario.horizontal ? ImCoolBarFlags_Horizontal : ImCoolBarFlags_Vertical;
+        const ImTextureID atlas        = (ImTextureID)(intptr_t)1; // never sampled: nothing is rendered
+
+        GeometryCounts peak;
+        for (int frame = 0; frame < 120; ++frame) {
+            ImVec2 mouse(1.0f, 1.0f);
+            if (vScenario.hovered) {
+                if (ImGuiWindow* window_ptr = ImGui::FindWindowByName(bar_label)) {
+                    const ImRect rect = window_ptr->Rect();
+                    const float t = 0.5f + 0.45f * sinf((float)frame * 0.05f);
+                    mouse = vScenario.horizontal ? ImVec2(ImLerp(rect.Min.x, rect.Max.x, t), (rect.Min.y + rect.Max.y) * 0.5f)
+                                                 : ImVec2((rect.Min.x + rect.Max.x) * 0.5f, ImLerp(rect.Min.y, rect.Max.y, t));
+                }
+            }
+            io.AddMousePosEvent(mouse.x, mouse.y);
+            io.DeltaTime = 1.0f / 60.0f;
+            ImGui::NewFrame();
+            if (ImGui::BeginCoolBar(bar_label, flags, config)) {
+                for (const char* item_label : item_labels) {
+                    if (vScenario.icons) {
+                        ImGui::CoolBarIcon(atlas); // opens its own item
+                    } else if (ImGui::CoolBarItem()) {
+                        const float w = ImGui::GetCoolBarItemWidth();
+                        ImGui::Button(item_label, ImVec2(w, w));
+                    }
+                    if (vScenario.labels) {
+                        ImGui::CoolBarLabel(item_label);
+                    }
+                }
+                ImGui::EndCoolBar();
+            }
+            ImGui::Render();
+            if (ImGuiWindow* window_ptr = ImGui::FindWindowByName(bar_label)) {
+                const ImDrawList* dl = window_ptr->DrawList;
+                peak.vtx = std::max(peak.vtx, dl->VtxBuffer.Size);
+                peak.idx = std::max(peak.idx, dl->IdxBuffer.Size);
+                peak.cmd = std::max(peak.cmd, dl->CmdBuffer.Size);
+                // Labels sit inside their icon's rect: the glyphs must come after the icon batch
+                if (vScenario.icons && vScenario.labels) {
+                    bool icons_last = false;
+                    for (const ImDrawCmd& cmd : dl->CmdBuffer) {
+                        if (cmd.ElemCount == 0) {
+                            continue;
+                        }
+#if IMGUI_VERSION_NUM >= 19200
+                        icons_last = cmd.TexRef._TexData == nullptr && cmd.TexRef._TexID == atlas;
+#else
+                        icons_last = cmd.TextureId == atlas;
+#endif
+                    }
+                    peak.covered_labels += icons_last ? 1 : 0;
+                }
+            }
+        }
+        return peak;
+    }
+
+    // Budget file: one "<scenario> <vertices> <indices> <draw commands>" line per scenario, '#' starts a comment
+    static bool readBudgets(const char* vPath, std::vector<GeometryBudget>& vBudgets) {
+        FILE* file_ptr = fopen(vPath, "r");
+        if (file_ptr == nullptr) {
+            fprintf(stderr, "cannot open budgets '%s'\n", vPath);
+            return false;
+        }
+        char line[256];
+        while (fgets(line, sizeof(line), file_ptr) != nullptr) {
+            char name[128];
+            GeometryBudget budget;
+            if (line[0] == '#' || sscanf(line, "%127s %d %d %d", name, &budget.counts.vtx, &budget.counts.idx, &budget.counts.cmd) != 4) {
+                continue;
+            }
+            budget.name = name;
+            vBudgets.push_back(budget);
+        }
+        fclose(file_ptr);
+        return true;
+    }
+
+    static bool writeBudgets(const char* vPath, const std::vector<GeometryBudget>& vMeasured) {
+        FILE* file_ptr = fopen(vPath, "w");
+        if (file_ptr == nullptr) {
+            fprintf(stderr, "cannot open '%s' for writing\n", vPath);
+            return false;
+        }
+        fprintf(file_ptr, "# ImCoolBar geometry budgets (ImCoolBar_bench budget), measured with Dear ImGui %s\n", IMGUI_VERSION);
+        fprintf(file_ptr, "# <scenario> <vertices> <indices> <draw commands>: peak of the bar window's draw list\n");
+        fprintf(file_ptr, "# Every scenario needs a line: a missing one fails the check\n");
+        for (const GeometryBudget& measured : vMeasured) {
+            fprintf(file_ptr, "%-28s %6d %6d %4d\n", measured.name.c_str(), measured.counts.vtx, measured.counts.idx, measured.counts.cmd);
+        }
+        fclose(file_ptr);
+        return true;
+    }
+
+    // Without a budgets file the counts are only reported. With one, fails when a scenario emits more vertices,
+    // indices or draw commands than its budget, or has no budget line. Budgets must be recorded with
+    // --write-budgets against the Dear ImGui version in use: glyph and AA geometry differ between versions.
+    static bool benchBudget(const char* vBudgetsPath, const char* vWritePath) {
+        std::vector<GeometryBudget> budgets;
+        const bool checked = vWritePath == nullptr && vBudgetsPath != nullptr;
+        if (checked && !readBudgets(vBudgetsPath, budgets)) {
+            return false;
+        }
+        std::vector<GeometryBudget> measured;
+        int exceeded = 0;
+        int covered  = 0;
+        printf("%-28s %16s %16s %12s  %s\n", "scenario", "vtx/budget", "idx/budget", "cmd/budget", "status");
+        for (const GeometryScenario& scenario : s_geometry_scenarios) {
+            GeometryBudget current;
+            current.name   = scenario.name;
+            current.counts = runGeometryScenario(scenario);
+            measured.push_back(current);
+            const GeometryBudget* budget_ptr = nullptr;
+            for (const GeometryBudget& budget : budgets) {
+                if (budget.name == current.name) {
+                    budget_ptr = &budget;
+                }
+            }
+            const char* status = vWritePath != nullptr ? "recorded" : "unchecked";
+            GeometryCounts limit;
+            if (budget_ptr != nullptr) {
+                limit  = budget_ptr->counts;
+                status = "ok";
+                if (current.counts.vtx > limit.vtx || current.counts.idx > limit.idx || current.counts.cmd > limit.cmd) {
+                    status = "EXCEEDED";
+                    ++exceeded;
+                }
+            } else if (checked) {
+                status = "MISSING"; // a scenario without a budget is not checked: record it
+                ++exceeded;
+            }
+            if (current.counts.covered_labels > 0) {
+                status = "LABELS UNDER ICONS"; // a draw order bug fails whether or not budgets are checked
+                ++covered;
+            }
+            printf("%-28s %7d/%-8d %7d/%-8d %5d/%-6d  %s\n", scenario.name, current.counts.vtx, limit.vtx, current.counts.idx, limit.idx,
+                   current.counts.cmd, limit.cmd, status);
+        }
+        if (covered > 0) {
+            printf("budget: %d scenarios draw icons over their labels\n", covered);
+            return false;
+        }
+        if (vWritePath != nullptr) {
+            return writeBudgets(vWritePath, measured);
+        }
+        if (!checked) {
+            printf("budget: counts of %d scenarios reported only, pass --budgets <file> to check them\n", (int)measured.size());
+            return true;
+        }
+        printf("budget: %d of %d scenarios over budget or without one\n", exceeded, (int)measured.size());
+        return exceeded == 0;
+    }
+
+    // Counting allocators installed with ImGui::SetAllocatorFunctions() (single-threaded: the alloc mode only)
+    static bool      s_alloc_counting = false;
+    static long long s_alloc_count    = 0;
+
+    static void* countingAlloc(size_t vSize, void* /*vUserData*/) {
+        if (s_alloc_counting) {
+            ++s_alloc_count;
+        }
+        return malloc(vSize);
+    }
+
+    static void countingFree(void* vPtr, void* /*vUserData*/) {
+        free(vPtr);
+    }
+
+    /// \brief One bar setup of the steady-state allocation check.
+    struct AllocScenario {
+        const char* name;
+        int         items;
+        bool        icons;    ///< \c CoolBarIcon() items instead of buttons.
+        bool        labels;   ///< A \c CoolBarLabel() under every item.
+        bool        cached;   ///< \c ImCoolBarConfig::cache_static_geometry.
+        bool        exact;    ///< \c ImCoolBarConfig::exact_layout.
+        bool        springs;  ///< Spring hover ramp and item sizes.
+    };
+
+    static const AllocScenario s_alloc_scenarios[] = {
+        // name               items  icons  labels cached exact  springs
+        {"buttons",           16,    false, false, false, false, false},
+        {"buttons_cached",    16,    false, false, true,  false, false},
+        {"buttons_exact",     16,    false, false, false, true,  false},
+        {"buttons_springs",   16,    false, false, false, false, true},
+        {"icons_1k",          1000,  true,  false, false, false, false},
+        {"labels",            16,    false, true,  false, false, false},
+        {"icons_labels_all",  64,    true,  true,  true,  true,  true},
+    };
+
+    // Counts the heap allocations made between BeginCoolBar() and EndCoolBar() after warm-up. The mouse sweeps
+    // the bar for 180 frames then leaves it for 60, so every run goes through hover ramps, animation and idle frames.
+    static long long runAllocScenario(const AllocScenario& vScenario, const int vWarmupFrames, const int vFrames, long long& vWarmupAllocs) {
+        HeadlessContext headless;
+        ImGuiIO& io = ImGui::GetIO();
+        const char* bar_label = "##alloc_bar";
+        const ImTextureID atlas = (ImTextureID)(intptr_t)1; // never sampled: nothing is rendered
+        ImCoolBarConfig config;
+        config.anchor                = ImVec2(0.5f, 1.0f);
+        config.cache_static_geometry = vScenario.cached;
+        config.exact_layout          = vScenario.exact;
+        if (vScenario.springs) {
+            config.anim_spring_settle_ms = 150.0f;
+            config.item_spring_settle_ms = 120.0f;
+        }
+        char item_label[16];
+        long long allocs = 0;
+        vWarmupAllocs = 0;
+        for (int frame = 0; frame < vWarmupFrames + vFrames; ++frame) {
+            ImVec2 mouse(1.0f, 1.0f);
+            const int cycle = frame % 240;
+            if (cycle < 180) {
+                if (ImGuiWindow* window_ptr = ImGui::FindWindowByName(bar_label)) {
+                    const ImRect rect = window_ptr->Rect();
+                    const float t = 0.5f + 0.45f * sinf((float)cycle * (2.0f * IM_PI / 180.0f));
+                    mouse = ImVec2(ImLerp(rect.Min.x, rect.Max.x, t), (rect.Min.y + rect.Max.y) * 0.5f);
+                }
+            }
+            io.AddMousePosEvent(mouse.x, mouse.y);
+            io.DeltaTime = 1.0f / 60.0f;
+            ImGui::NewFrame();
+            s_alloc_count    = 0;
+            s_alloc_counting = true;
+            if (ImGui::BeginCoolBar(bar_label, ImCoolBarFlags_Horizontal, config)) {
+                for (int i = 0; i < vScenario.items; ++i) {
+                    snprintf(item_label, sizeof(item_label), "%d", i % 100);
+                    if (vScenario.icons) {
+                        ImGui::CoolBarIcon(atlas); // opens its own item
+                    } else if (ImGui::CoolBarItem()) {
+                        const float w = ImGui::GetCoolBarItemWidth();
+                        ImGui::Button(item_label, ImVec2(w, w));
+                    }
+                    if (vScenario.labels) {
+                        ImGui::CoolBarLabel(item_label);
+                    }
+                }
+                ImGui::EndCoolBar();
+            }
+            s_alloc_counting = false;
+            if (frame < vWarmupFrames) {
+                vWarmupAllocs += s_alloc_count;
+            } else {
+                allocs += s_alloc_count;
+            }
+            ImGui::Render();
+        }
+        return allocs;
+    }
+
+    // Bars with generated labels come and go (one per opened document...): every 10 frames a new bar replaces
+    // the oldest of 8, and bars are freed 0.5 s after their last use. The bar map must not grow past what the
+    // first churn cycles needed.
+    static bool runChurnScenario(int& vFirstMapPeak, int& vLastMapPeak, int& vBarsCreated) {
+        HeadlessContext headless;
+        ImGuiIO& io = ImGui::GetIO();
+        io.ConfigMemoryCompactTimer = 0.5f;
+        const int frames = 6000;
+        char bar_label[32];
+        vFirstMapPeak = 0;
+        vLastMapPeak  = 0;
+        vBarsCreated  = 0;
+        for (int frame = 0; frame < frames; ++frame) {
+            io.AddMousePosEvent(1.0f, 1.0f);
+            io.DeltaTime = 1.0f / 60.0f;
+            ImGui::NewFrame();
+            const int newest = frame / 10;
+            vBarsCreated = newest + 1;
+            for (int bar = ImMax(newest - 7, 0); bar <= newest; ++bar) {
+                snprintf(bar_label, sizeof(bar_label), "##churn_%d", bar);
+                if (ImGui::BeginCoolBar(bar_label, ImCoolBarFlags_Horizontal)) {
+                    for (int i = 0; i < 4; ++i) {
+                        if (ImGui::CoolBarItem()) {
+                            const float w = ImGui::GetCoolBarItemWidth();
+                            ImGui::Dummy(ImVec2(w, w));
+                        }
+                    }
+                    ImGui::EndCoolBar();
+                }
+            }
+            ImGui::Render();
+            const int map_entries = ImGui::GetCoolBarContextStats().map_entries;
+            int& peak = frame < frames / 2 ? vFirstMapPeak : vLastMapPeak;
+            peak = ImMax(peak, map_entries);
+        }
+        return vLastMapPeak <= vFirstMapPeak;
+    }
+
+    // Steady state must not allocate: fails when any scenario allocates after warm-up
+    static bool benchAlloc() {
+        ImGui::SetAllocatorFunctions(countingAlloc, countingFree, nullptr);
+        const int warmup_frames = 720;
+        const int frames        = 4800;
+        int failed = 0;
+        printf("%-20s %14s %14s  %s\n", "scenario", "warmup allocs", "steady allocs", "status");
+        for (const AllocScenario& scenario : s_alloc_scenarios) {
+            long long warmup_allocs = 0;
+            const long long allocs = runAllocScenario(scenario, warmup_frames, frames, warmup_allocs);
+            if (allocs != 0) {
+                ++failed;
+            }
+            printf("%-20s %14lld %14lld  %s\n", scenario.name, warmup_allocs, allocs, allocs == 0 ? "ok" : "ALLOCATES");
+        }
+        printf("alloc: %d frames after %d warm-up frames, %d of %d scenarios allocate\n", frames, warmup_frames, failed,
+               (int)(sizeof(s_alloc_scenarios) / sizeof(s_alloc_scenarios[0])));
+
+        int first_map_peak = 0, last_map_peak = 0, bars_created = 0;
+        const bool churn_ok = runChurnScenario(first_map_peak, last_map_peak, bars_created);
+        printf("alloc: churn of %d bars, bar map peak %d entries in the first half, %d in the second: %s\n", bars_created, first_map_peak,
+               last_map_peak, churn_ok ? "ok" : "GROWS");
+        return failed == 0 && churn_ok;
+    }
+
+    /// \brief In-memory stand-ins for the icon decoder and the GPU upload.
+    struct IconsDemo {
+        std::thread::id      ui_thread;
+        std::atomic<int>     decodes{0};
+        std::atomic<int>     decodes_on_ui{0};
+        int                  uploads     = 0;
+        int                  releases    = 0;
+        int                  max_uploads = 0;  ///< Most uploads seen in one Update().
+        int                  frame_uploads = 0;
+    };
+
+    // Stand-in decoder: a 64x64 gradient after ~2 ms of "work"
+    static bool decodeIconStandIn(const char* vKey, std::vector<unsigned char>& vOutRgba, int& vOutWidth, int& vOutHeight, void* vUserData) {
+        IconsDemo& demo = *(IconsDemo*)vUserData;
+        if (std::this_thread::get_id() == demo.ui_thread) {
+            ++demo.decodes_on_ui;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        const unsigned char seed = (unsigned char)ImHashStr(vKey);
+        vOutWidth  = 64;
+        vOutHeight = 64;
+        vOutRgba.resize(64 * 64 * 4);
+        for (int i = 0; i < 64 * 64; ++i) {
+            vOutRgba[i * 4 + 0] = (unsigned char)(seed + i);
+            vOutRgba[i * 4 + 1] = (unsigned char)(i >> 4);
+            vOutRgba[i * 4 + 2] = seed;
+            vOutRgba[i * 4 + 3] = 255;
+        }
+        ++demo.decodes;
+        return true;
+    }
+
+    // Stand-in upload: no GPU, texture ids are counters
+    static ImTextureID uploadIconStandIn(const unsigned char* /*vRgba*/, int /*vWidth*/, int /*vHeight*/, void* vUserData) {
+        IconsDemo& demo = *(IconsDemo*)vUserData;
+        ++demo.uploads;
+        ++demo.frame_uploads;
+        return (ImTextureID)(intptr_t)(100 + demo.uploads);
+    }
+
+    static void releaseIconStandIn(ImTextureID /*vTexture*/, void* vUserData) {
+        ++((IconsDemo*)vUserData)->releases;
+    }
+
+    // A 64-icon dock populated through ImCoolBarIconProvider: every icon must show up within 600 frames,
+    // decodes must run off the UI thread and uploads must respect the per-frame budget
+    static bool benchIcons() {
+        IconsDemo demo;
+        demo.ui_thread = std::this_thread::get_id();
+        ImCoolBarIconProviderConfig provider_config;
+        provider_config.decode            = decodeIconStandIn;
+        provider_config.upload            = uploadIconStandIn;
+        provider_config.release           = releaseIconStandIn;
+        provider_config.user_data         = &demo;
+        provider_config.workers_count     = 2;
+        provider_config.cache_capacity    = 96;
+        provider_config.uploads_per_frame = 4;
+
+        const int icons_count = 64;
+        std::vector<std::string> keys(icons_count);
+        for (int i = 0; i < icons_count; ++i) {
+            keys[i] = "memory://thumbnail/" + std::to_string(i);
+        }
+        const ImTextureID placeholder = (ImTextureID)(intptr_t)1;
+        int    ready_frame  = -1;
+        double max_frame_us = 0.0;
+        {
+            HeadlessContext headless;
+            ImGuiIO& io = ImGui::GetIO();
+            ImCoolBarIconProvider provider(provider_config);
+            for (int frame = 0; frame < 600 && ready_frame < 0; ++frame) {
+                io.AddMousePosEvent(1.0f, 1.0f);
+                io.DeltaTime = 1.0f / 60.0f;
+                ImGui::NewFrame();
+                const Clock::time_point start = Clock::now();
+                demo.frame_uploads = 0;
+                provider.Update();
+                demo.max_uploads = std::max(demo.max_uploads, demo.frame_uploads);
+                if (ImGui::BeginCoolBar("##icons_dock", ImCoolBarFlags_Horizontal)) {
+                    for (const std::string& key : keys) {
+                        ImGui::CoolBarProviderIcon(provider, key.c_str(), placeholder);
+                    }
+                    ImGui::EndCoolBar();
+                }
+                max_frame_us = std::max(max_frame_us, elapsedNs(start) * 1e-3);
+                ImGui::Render();
+                if (provider.GetStats().ready == icons_count) {
+                    ready_frame = frame;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1)); // leaves the workers some time, like vsync would
+            }
+        }
+        const bool ok = ready_frame >= 0 && demo.decodes_on_ui.load() == 0 && demo.max_uploads <= provider_config.uploads_per_frame && demo.releases == demo.uploads;
+        printf("icons: %d icons ready after %d frames, %d decodes (%d on the UI thread), %d uploads (max %d/frame), %d released, "
+               "max UI frame %.1f us: %s\n",
+               icons_count, ready_frame + 1, demo.decodes.load(), demo.decodes_on_ui.load(), demo.uploads, demo.max_uploads, demo.releases, max_frame_us,
+               ok ? "ok" : "FAILED");
+        return ok;
+    }
+
+    /// \brief Edit applied every 10th frame of a model phase.
+    enum ModelEdit {
+        ModelEdit_None = 0,  ///< Idle bar only.
+        ModelEdit_Dirty,     ///< \c MarkItemDirty() on one item.
+        ModelEdit_Move,      ///< \c MoveItem() of the first item to the end.
+    };
+
+    /// \brief Timings of one model phase, split between edit frames and the idle frames after them.
+    struct ModelPhase {
+        double edit_ns     = 0.0;
+        double idle_ns     = 0.0;
+        int    edit_frames = 0;
+        int    idle_frames = 0;
+        int    edit_calls  = 0;  ///< Draw callback calls on edit frames.
+        int    idle_calls  = 0;  ///< Draw callback calls on idle frames (0 while the retained geometry is replayed).
+    };
+
+    static bool drawModelItem(ImGuiID /*vId*/, void* /*vPayload*/, float vSize, void* vUserData) {
+        ++*(int*)vUserData;
+        ImGui::Dummy(ImVec2(vSize, vSize));
+        return false;
+    }
+
+    static ModelPhase runModelPhase(ImCoolBarModel& vModel, int& vCalls, const ModelEdit vEdit, const int vFrames) {
+        ImGuiIO& io = ImGui::GetIO();
+        ModelPhase phase;
+        for (int frame = 0; frame < vFrames; ++frame) {
+            const bool edit = vEdit != ModelEdit_None && frame % 10 == 0;
+            const Clock::time_point start = Clock::now();
+            if (edit && vEdit == ModelEdit_Dirty) {
+                vModel.MarkItemDirty(vModel.GetItemId((frame / 10) % vModel.GetItemsCount()));
+            } else if (edit && vEdit == ModelEdit_Move) {
+                vModel.MoveItem(vModel.GetItemId(0), vModel.GetItemsCount() - 1);
+            }
+            const double edit_ns = elapsedNs(start);
+            io.AddMousePosEvent(1.0f, 1.0f); // parked away from the bar: every frame is static
+            io.DeltaTime = 1.0f / 60.0f;
+            ImGui::NewFrame();
+            vCalls = 0;
+            const Clock::time_point draw_start = Clock::now();
+            vModel.Draw();
+            const double ns = edit_ns + elapsedNs(draw_start);
+            ImGui::Render();
+            if (edit) {
+                phase.edit_ns += ns;
+                phase.edit_calls += vCalls;
+                ++phase.edit_frames;
+            } else {
+                phase.idle_ns += ns;
+                phase.idle_calls += vCalls;
+                ++phase.idle_frames;
+            }
+        }
+        return phase;
+    }
+
+    // ImCoolBarModel on an idle bar: idle frames must replay the retained geometry without calling the draw
+    // callback, and the frames after MarkItemDirty()/MoveItem() redraw the visible items once
+    static bool benchModel() {
+        const int item_counts[] = {64, 1024};
+        const char* phase_names[] = {"idle", "dirty", "move"};
+        bool ok = true;
+        printf("%-22s %14s %10s %14s %10s  %s\n", "scenario", "idle ns/frame", "idle calls", "edit ns/frame", "edit calls", "status");
+        for (const int items : item_counts) {
+            HeadlessContext headless;
+            int calls = 0;
+            ImCoolBarModel model("##model_bench", ImCoolBarFlags_Horizontal);
+            model.SetDrawCallback(drawModelItem, &calls);
+            for (int i = 0; i < items; ++i) {
+                model.AddItem((ImGuiID)(i + 1));
+            }
+            runModelPhase(model, calls, ModelEdit_None, 60); // settles the hover ramp and retains a static frame
+            for (int edit = ModelEdit_None; edit <= ModelEdit_Move; ++edit) {
+                const ModelPhase phase = runModelPhase(model, calls, (ModelEdit)edit, 600);
+                const bool phase_ok = phase.idle_calls == 0 && (edit == ModelEdit_None || phase.edit_calls >= phase.edit_frames);
+                char name[32];
+                snprintf(name, sizeof(name), "%s/%d", phase_names[edit], items);
+                printf("%-22s %14.0f %10d %14.0f %10d  %s\n", name, phase.idle_ns / std::max(phase.idle_frames, 1), phase.idle_calls,
+                       phase.edit_ns / std::max(phase.edit_frames, 1), phase.edit_calls, phase_ok ? "ok" : "REDRAWS WHEN IDLE");
+                ok &= phase_ok;
+            }
+        }
+        return ok;
+    }
+
+    static bool writeJson(const char* vPath, const std::vector<FrameResult>& vResults) {
+        FILE* file_ptr = fopen(vPath, "w");
+        if (file_ptr == nullptr) {
+            fprintf(stderr, "cannot open '%s' for writing\n", vPath);
+            return false;
+        }
+        fprintf(file_ptr, "{\n  \"imgui_version\": \"%s\",\n  \"results\": [\n", IMGUI_VERSION);
+        for (size_t i = 0; i < vResults.size(); ++i) {
+            const FrameResult& r = vResults[i];
+            fprintf(file_ptr,
+                    "    {\"name\": \"%s\", \"bars\": %d, \"items\": %d, \"orientation\": \"%s\", \"smoothing\": %s, "
+                    "\"hovered\": %s, \"cached\": %s, \"frames\": %d, \"ns_per_frame\": %.1f, \"ns_per_item\": %.3f}%s\n",
+                    scenarioName(r.scenario).c_str(), r.scenario.bars, r.scenario.items, r.scenario.horizontal ? "horizontal" : "vertical",
+                    r.scenario.smoothing ? "true" : "false", r.scenario.hovered ? "true" : "false", r.scenario.cached ? "true" : "false", r.frames, r.ns_per_frame, r.ns_per_item,
+                    i + 1 < vResults.size() ? "," : "");
+        }
+        fprintf(file_ptr, "  ]\n}\n");
+        fclose(file_ptr);
+        return true;
+    }
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const char* mode      = "all";
+    const char* json_path = nullptr;
+    const char* budgets_path       = nullptr;
+    const char* write_budgets_path = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (strcmp(argv[i], "--budgets") == 0 && i + 1 < argc) {
+            budgets_path = argv[++i];
+        } else if (strcmp(argv[i], "--write-budgets") == 0 && i + 1 < argc) {
+            write_budgets_path = argv[++i];
+        } else if (argv[i][0] != '-') {
+            mode = argv[i];
+        } else {
+            fprintf(stderr, "usage: %s [kernel|frames|layout_mt|policy|budget|alloc|icons|model|all] [--json <file>] [--budgets <file>] [--write-budgets <file>]\n", argv[0]);
+            return 1;
+        }
+    }
+    const bool all = strcmp(mode, "all") == 0;
+    if (!all && strcmp(mode, "kernel") != 0 && strcmp(mode, "frames") != 0 && strcmp(mode, "layout_mt") != 0 && strcmp(mode, "policy") != 0 &&
+        strcmp(mode, "budget") != 0 && strcmp(mode, "alloc") != 0 && strcmp(mode, "icons") != 0 && strcmp(mode, "model") != 0) {
+        fprintf(stderr, "unknown mode '%s' (expected: kernel, frames, layout_mt, policy, budget, alloc, icons, model, all)\n", mode);
+        return 1;
+    }
+    if (all || strcmp(mode, "kernel") == 0) {
+        benchKernel();
+    }
+    if (all || strcmp(mode, "layout_mt") == 0) {
+        if (!benchLayoutMt()) {
+            return 1;
+        }
+    }
+    if (all || strcmp(mode, "budget") == 0) {
+        if (!benchBudget(budgets_path, write_budgets_path)) {
+            return 1;
+        }
+    }
+    if (all || strcmp(mode, "alloc") == 0) {
+        if (!benchAlloc()) {
+            return 1;
+        }
+    }
+    if (all || strcmp(mode, "icons") == 0) {
+        if (!benchIcons()) {
+            return 1;
+        }
+    }
+    if (all || strcmp(mode, "model") == 0) {
+        if (!benchModel()) {
+            return 1;
+        }
+    }
+    if (all || strcmp(mode, "policy") == 0) {
+        benchPolicy();
+    }
+    if (all || strcmp(mode, "frames") == 0) {
+        const std::vector<FrameResult> results = benchFrames();
+        if (json_path != nullptr && !writeJson(json_path, results)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
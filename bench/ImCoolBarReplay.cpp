@@ -0,0 +1,503 @@
+/*
+MIT License
+
+Copyright (c) 2025 NewYaroslav
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Deterministic input-trace replay: feeds recorded (or built-in) mouse/DeltaTime traces to a headless
+// CoolBar and measures how the item under the cursor responds.
+// Usage: ImCoolBar_replay [--trace <file>] [--save-traces <file>] [--csv <file>] [--json <file>] [--set <field>=<value>]...
+//
+// Trace file: one "<dt_ms> <mouse_x> <mouse_y>" line per frame, screen coordinates of a 1920x1080 display with
+// the bar anchored at the bottom center, '#' starts a comment. A "# origin: bar" line makes the coordinates
+// relative to the bottom center of the bar instead. --save-traces writes the built-in traces in that format;
+// ImCoolBarTraceRecorder.h records the frames of an application's bar.
+
+#include "ImCoolBar.h"
+#include "imgui_internal.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+    const int   s_items_count   = 12;
+    const float s_settle_tol_px = 0.5f;  // an item is settled once it stays this close to its final size
+
+    /// \brief One frame of an input trace.
+    struct TraceFrame {
+        float  dt_ms;
+        ImVec2 mouse;
+    };
+
+    /// \brief A named input trace.
+    struct Trace {
+        std::string             name;
+        std::vector<TraceFrame> frames;
+    };
+
+    /// \brief Response of the item under the cursor while it stays there.
+    struct Episode {
+        int   item;
+        float start_ms;
+        float duration_ms;
+        float peak_px;
+        float final_px;
+        float time_to_peak_ms;
+        float time_to_settle_ms;
+        float overshoot_px;
+    };
+
+    /// \brief Measurements of one trace.
+    struct TraceResult {
+        std::string          name;
+        int                  frames;
+        float                jitter_rms_px;  ///< RMS of the per-frame second difference of item sizes while hovered.
+        std::vector<Episode> episodes;
+    };
+
+    /// \brief Headless ImGui context: fonts are built on the CPU, nothing is rendered.
+    struct HeadlessContext {
+        ImGuiContext* ctx = nullptr;
+
+        HeadlessContext() {
+            ctx = ImGui::CreateContext();
+            ImGuiIO& io    = ImGui::GetIO();
+            io.IniFilename = nullptr;
+            io.LogFilename = nullptr;
+            io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+            io.DeltaTime   = 1.0f / 60.0f;
+            unsigned char* pixels = nullptr;
+            int width = 0, height = 0;
+            io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+        }
+
+        ~HeadlessContext() {
+            ImGui::DestroyContext(ctx);
+        }
+    };
+
+    /// \brief Submits the replayed bar and keeps this frame's item rects and sizes.
+    struct ReplayBar {
+        ImCoolBarConfig    config;
+        std::vector<float> sizes;
+        std::vector<float> item_min;  ///< Main-axis start of each item (screen px).
+        ImRect             window_rect;
+
+        void submit(const ImVec2& vMouse, const float vDtMs) {
+            ImGuiIO& io = ImGui::GetIO();
+            io.AddMousePosEvent(vMouse.x, vMouse.y);
+            io.DeltaTime = ImMax(vDtMs, 0.1f) * 0.001f;
+            ImGui::NewFrame();
+            sizes.assign(s_items_count, 0.0f);
+            item_min.assign(s_items_count, 0.0f);
+            if (ImGui::BeginCoolBar("##replay_bar", ImCoolBarFlags_Horizontal, config)) {
+                for (int i = 0; i < s_items_count; ++i) {
+                    if (ImGui::CoolBarItem()) {
+                        const float w = ImGui::GetCoolBarItemWidth();
+                        item_min[i] = ImGui::GetCursorScreenPos().x;
+                        sizes[i]    = w;
+                        ImGui::Dummy(ImVec2(w, w));
+                    }
+                }
+                window_rect = ImGui::GetCurrentWindow()->Rect();
+                ImGui::EndCoolBar();
+            }
+            ImGui::Render();
+        }
+
+        int itemAt(const ImVec2& vMouse) const {
+            if (!window_rect.Contains(vMouse)) {
+                return -1;
+            }
+            for (int i = 0; i < s_items_count; ++i) {
+                if (vMouse.x >= item_min[i] && vMouse.x < item_min[i] + sizes[i]) {
+                    return i;
+                }
+            }
+            return -1;
+        }
+    };
+
+    /// \brief Let the bar settle at its idle size, away from the mouse.
+    static void settleIdle(ReplayBar& vBar) {
+        for (int frame = 0; frame < 10; ++frame) {
+            vBar.submit(ImVec2(1.0f, 1.0f), 1000.0f / 60.0f);
+        }
+    }
+
+    // Built-in traces: approach item 3, glide to item 8, jump to item 5, leave. Positions come from the
+    // idle bar so the same trace fits any normal_size; dt follows the given generator.
+    static Trace makeDockTrace(const char* vName, const ImCoolBarConfig& vConfig, float (*vDtMs)(int)) {
+        HeadlessContext headless;
+        ReplayBar bar;
+        bar.config = vConfig;
+        settleIdle(bar);
+        const float center_y = (bar.window_rect.Min.y + bar.window_rect.Max.y) * 0.5f;
+        const float outside_y = bar.window_rect.Min.y - 120.0f;
+        auto item_x = [&bar](int vItem) { return bar.item_min[vItem] + bar.sizes[vItem] * 0.5f; };
+
+        Trace trace;
+        trace.name = vName;
+        float elapsed_ms = 0.0f;
+        auto move = [&](const ImVec2& vFrom, const ImVec2& vTo, const float vDurationMs) {
+            const float start_ms = elapsed_ms;
+            do {
+                TraceFrame frame;
+                frame.dt_ms = vDtMs((int)trace.frames.size());
+                elapsed_ms += frame.dt_ms;
+                const float t = vDurationMs > 0.0f ? ImSaturate((elapsed_ms - start_ms) / vDurationMs) : 1.0f;
+                const float s = t * t * (3.0f - 2.0f * t); // smoothstep: hand-like acceleration
+                frame.mouse = ImLerp(vFrom, vTo, s);
+                trace.frames.push_back(frame);
+            } while (elapsed_ms - start_ms < vDurationMs);
+        };
+        const ImVec2 outside(item_x(3), outside_y);
+        const ImVec2 on3(item_x(3), center_y);
+        const ImVec2 on8(item_x(8), center_y);
+        const ImVec2 on5(item_x(5), center_y);
+        move(outside, outside, 500.0f);
+        move(outside, on3, 100.0f);
+        move(on3, on3, 1000.0f);
+        move(on3, on8, 500.0f);
+        move(on8, on8, 1000.0f);
+        move(on8, on5, 50.0f);
+        move(on5, on5, 1000.0f);
+        move(on5, outside, 80.0f);
+        move(outside, outside, 1000.0f);
+        return trace;
+    }
+
+    static float dt60(int /*vFrame*/) { return 1000.0f / 60.0f; }
+    static float dt144(int /*vFrame*/) { return 1000.0f / 144.0f; }
+    static float dtUneven(int vFrame) {
+        // Deterministic 8-25 ms frames with a 50 ms hitch every 97 frames
+        const unsigned int h = (unsigned int)vFrame * 2654435761u;
+        return (vFrame % 97 == 96) ? 50.0f : 8.0f + (float)(h >> 16 & 1023u) / 1023.0f * 17.0f;
+    }
+
+    static bool loadTrace(const char* vPath, const ImCoolBarConfig& vConfig, Trace& vTrace) {
+        FILE* file_ptr = fopen(vPath, "r");
+        if (file_ptr == nullptr) {
+            fprintf(stderr, "cannot open trace '%s'\n", vPath);
+            return false;
+        }
+        vTrace.name = vPath;
+        bool bar_origin = false;
+        char line[256];
+        while (fgets(line, sizeof(line), file_ptr) != nullptr) {
+            TraceFrame frame;
+            if (strncmp(line, "# origin: bar", 13) == 0) {
+                bar_origin = true;
+            }
+            if (line[0] == '#' || sscanf(line, "%f %f %f", &frame.dt_ms, &frame.mouse.x, &frame.mouse.y) != 3) {
+                continue;
+            }
+            vTrace.frames.push_back(frame);
+        }
+        fclose(file_ptr);
+        if (bar_origin) {
+            // Recorded relative to the bar (ImCoolBarTraceRecorder): move to the bottom center of the idle replay bar
+            HeadlessContext headless;
+            ReplayBar bar;
+            bar.config = vConfig;
+            settleIdle(bar);
+            const ImVec2 origin((bar.window_rect.Min.x + bar.window_rect.Max.x) * 0.5f, bar.window_rect.Max.y);
+            for (TraceFrame& frame : vTrace.frames) {
+                frame.mouse.x += origin.x;
+                frame.mouse.y += origin.y;
+            }
+        }
+        return !vTrace.frames.empty();
+    }
+
+    static bool writeTrace(const char* vPath, const std::vector<Trace>& vTraces) {
+        FILE* file_ptr = fopen(vPath, "w");
+        if (file_ptr == nullptr) {
+            fprintf(stderr, "cannot open '%s' for writing\n", vPath);
+            return false;
+        }
+        for (const Trace& trace : vTraces) {
+            fprintf(file_ptr, "# trace %s: <dt_ms> <mouse_x> <mouse_y>\n", trace.name.c_str());
+            for (const TraceFrame& frame : trace.frames) {
+                fprintf(file_ptr, "%.4f %.3f %.3f\n", frame.dt_ms, frame.mouse.x, frame.mouse.y);
+            }
+        }
+        fclose(file_ptr);
+        return true;
+    }
+
+    static Episode measureEpisode(const int vItem, const std::vector<float>& vTimesMs, const std::vector<float>& vSizes, const int vBegin, const int vEnd) {
+        Episode episode;
+        episode.item        = vItem;
+        episode.start_ms    = vTimesMs[vBegin];
+        episode.duration_ms = vTimesMs[vEnd - 1] - vTimesMs[vBegin];
+        episode.final_px    = vSizes[vEnd - 1];
+        episode.peak_px     = vSizes[vBegin];
+        int peak_frame = vBegin;
+        for (int f = vBegin; f < vEnd; ++f) {
+            if (vSizes[f] > episode.peak_px) {
+                episode.peak_px = vSizes[f];
+                peak_frame      = f;
+            }
+        }
+        int settle_frame = vEnd - 1;
+        while (settle_frame > vBegin && fabsf(vSizes[settle_frame - 1] - episode.final_px) <= s_settle_tol_px) {
+            --settle_frame;
+        }
+        episode.time_to_peak_ms   = vTimesMs[peak_frame] - vTimesMs[vBegin];
+        episode.time_to_settle_ms = vTimesMs[settle_frame] - vTimesMs[vBegin];
+        episode.overshoot_px      = ImMax(episode.peak_px - episode.final_px, 0.0f);
+        return episode;
+    }
+
+    static TraceResult replayTrace(const Trace& vTrace, const ImCoolBarConfig& vConfig) {
+        HeadlessContext headless;
+        ReplayBar bar;
+        bar.config = vConfig;
+
+        // Per frame: time, hovered item and that item's size; all sizes for the jitter
+        const int frames_count = (int)vTrace.frames.size();
+        std::vector<float> times_ms(frames_count);
+        std::vector<int>   targets(frames_count);
+        std::vector<std::vector<float>> sizes(frames_count);
+        float elapsed_ms = 0.0f;
+        for (int f = 0; f < frames_count; ++f) {
+            const TraceFrame& frame = vTrace.frames[f];
+            elapsed_ms += frame.dt_ms;
+            bar.submit(frame.mouse, frame.dt_ms);
+            times_ms[f] = elapsed_ms;
+            targets[f]  = bar.itemAt(frame.mouse);
+            sizes[f]    = bar.sizes;
+        }
+
+        TraceResult result;
+        result.name   = vTrace.name;
+        result.frames = frames_count;
+        double jitter_sum = 0.0;
+        int    jitter_count = 0;
+        for (int f = 2; f < frames_count; ++f) {
+            if (targets[f] < 0) {
+                continue;
+            }
+            for (int i = 0; i < s_items_count; ++i) {
+                const float d2 = sizes[f][i] - 2.0f * sizes[f - 1][i] + sizes[f - 2][i];
+                jitter_sum += (double)d2 * d2;
+                ++jitter_count;
+            }
+        }
+        result.jitter_rms_px = jitter_count > 0 ? (float)sqrt(jitter_sum / jitter_count) : 0.0f;
+
+        std::vector<float> item_sizes(frames_count);
+        int begin = 0;
+        for (int f = 1; f <= frames_count; ++f) {
+            if (f < frames_count && targets[f] == targets[begin]) {
+                continue;
+            }
+            const int item = targets[begin];
+            if (item >= 0 && f - begin >= 2) {
+                for (int k = begin; k < f; ++k) {
+                    item_sizes[k] = sizes[k][item];
+                }
+                result.episodes.push_back(measureEpisode(item, times_ms, item_sizes, begin, f));
+            }
+            begin = f;
+        }
+        return result;
+    }
+
+    static bool setConfigField(ImCoolBarConfig& vConfig, const char* vAssignment) {
+        char name[64];
+        float value = 0.0f;
+        if (sscanf(vAssignment, "%63[^=]=%f", name, &value) != 2) {
+            return false;
+        }
+        struct FloatField { const char* name; float* ptr; };
+        const FloatField fields[] = {
+            {"normal_size", &vConfig.normal_size},
+            {"hovered_size", &vConfig.hovered_size},
+            {"effect_strength", &vConfig.effect_strength},
+            {"mouse_smoothing_ms", &vConfig.mouse_smoothing_ms},
+            {"anim_smoothing_ms", &vConfig.anim_smoothing_ms},
+            {"anim_step", &vConfig.anim_step},
+            {"anim_step_per_second", &vConfig.anim_step_per_second},
+            {"mouse_min_cutoff_hz", &vConfig.mouse_min_cutoff_hz},
+            {"mouse_beta", &vConfig.mouse_beta},
+            {"mouse_deriv_cutoff_hz", &vConfig.mouse_deriv_cutoff_hz},
+            {"mouse_prediction_ms", &vConfig.mouse_prediction_ms},
+            {"anim_spring_settle_ms", &vConfig.anim_spring_settle_ms},
+            {"item_spring_settle_ms", &vConfig.item_spring_settle_ms},
+        };
+        for (const FloatField& field : fields) {
+            if (strcmp(field.name, name) == 0) {
+                *field.ptr = value;
+                return true;
+            }
+        }
+        if (strcmp(name, "mouse_filter") == 0) {
+            vConfig.mouse_filter = (ImCoolBarMouseFilter)value;
+            return true;
+        }
+        if (strcmp(name, "exact_layout") == 0) {
+            vConfig.exact_layout = value != 0.0f;
+            return true;
+        }
+        return false;
+    }
+
+    /// \brief Write a JSON string literal (trace names are file paths).
+    static void writeJsonString(FILE* vFile, const char* vText) {
+        fputc('"', vFile);
+        for (const unsigned char* c = (const unsigned char*)vText; *c != 0; ++c) {
+            if (*c == '"' || *c == '\\') {
+                fprintf(vFile, "\\%c", *c);
+            } else if (*c < 0x20) {
+                fprintf(vFile, "\\u%04x", *c);
+            } else {
+                fputc(*c, vFile);
+            }
+        }
+        fputc('"', vFile);
+    }
+
+    static void writeConfigJson(FILE* vFile, const ImCoolBarConfig& vConfig) {
+        fprintf(vFile,
+                "{\"normal_size\": %g, \"hovered_size\": %g, \"effect_strength\": %g, \"mouse_smoothing_ms\": %g, \"anim_smoothing_ms\": %g, "
+                "\"anim_step\": %g, \"anim_step_per_second\": %g, \"mouse_filter\": %d, \"anim_spring_settle_ms\": %g, \"item_spring_settle_ms\": %g, \"exact_layout\": %s}",
+                vConfig.normal_size, vConfig.hovered_size, vConfig.effect_strength, vConfig.mouse_smoothing_ms, vConfig.anim_smoothing_ms, vConfig.anim_step,
+                vConfig.anim_step_per_second, vConfig.mouse_filter, vConfig.anim_spring_settle_ms, vConfig.item_spring_settle_ms, vConfig.exact_layout ? "true" : "false");
+    }
+
+    static bool writeCsv(const char* vPath, const std::vector<TraceResult>& vResults) {
+        FILE* file_ptr = fopen(vPath, "w");
+        if (file_ptr == nullptr) {
+            fprintf(stderr, "cannot open '%s' for writing\n", vPath);
+            return false;
+        }
+        fprintf(file_ptr, "trace,episode,item,start_ms,duration_ms,peak_px,final_px,time_to_peak_ms,time_to_settle_ms,overshoot_px,jitter_rms_px\n");
+        for (const TraceResult& result : vResults) {
+            for (size_t e = 0; e < result.episodes.size(); ++e) {
+                const Episode& ep = result.episodes[e];
+                fprintf(file_ptr, "%s,%d,%d,%.2f,%.2f,%.3f,%.3f,%.2f,%.2f,%.3f,%.4f\n", result.name.c_str(), (int)e, ep.item, ep.start_ms, ep.duration_ms,
+                        ep.peak_px, ep.final_px, ep.time_to_peak_ms, ep.time_to_settle_ms, ep.overshoot_px, result.jitter_rms_px);
+            }
+        }
+        fclose(file_ptr);
+        return true;
+    }
+
+    static bool writeJson(const char* vPath, const ImCoolBarConfig& vConfig, const std::vector<TraceResult>& vResults) {
+        FILE* file_ptr = fopen(vPath, "w");
+        if (file_ptr == nullptr) {
+            fprintf(stderr, "cannot open '%s' for writing\n", vPath);
+            return false;
+        }
+        fprintf(file_ptr, "{\n  \"imgui_version\": \"%s\",\n  \"settle_tolerance_px\": %g,\n  \"config\": ", IMGUI_VERSION, s_settle_tol_px);
+        writeConfigJson(file_ptr, vConfig);
+        fprintf(file_ptr, ",\n  \"traces\": [\n");
+        for (size_t t = 0; t < vResults.size(); ++t) {
+            const TraceResult& result = vResults[t];
+            fprintf(file_ptr, "    {\"name\": ");
+            writeJsonString(file_ptr, result.name.c_str());
+            fprintf(file_ptr, ", \"frames\": %d, \"jitter_rms_px\": %.4f, \"episodes\": [\n", result.frames, result.jitter_rms_px);
+            for (size_t e = 0; e < result.episodes.size(); ++e) {
+                const Episode& ep = result.episodes[e];
+                fprintf(file_ptr,
+                        "      {\"item\": %d, \"start_ms\": %.2f, \"duration_ms\": %.2f, \"peak_px\": %.3f, \"final_px\": %.3f, "
+                        "\"time_to_peak_ms\": %.2f, \"time_to_settle_ms\": %.2f, \"overshoot_px\": %.3f}%s\n",
+                        ep.item, ep.start_ms, ep.duration_ms, ep.peak_px, ep.final_px, ep.time_to_peak_ms, ep.time_to_settle_ms, ep.overshoot_px,
+                        e + 1 < result.episodes.size() ? "," : "");
+            }
+            fprintf(file_ptr, "    ]}%s\n", t + 1 < vResults.size() ? "," : "");
+        }
+        fprintf(file_ptr, "  ]\n}\n");
+        fclose(file_ptr);
+        return true;
+    }
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const char* trace_path  = nullptr;
+    const char* save_path   = nullptr;
+    const char* csv_path    = nullptr;
+    const char* json_path   = nullptr;
+    ImCoolBarConfig config;
+    config.anchor = ImVec2(0.5f, 1.0f);
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else if (strcmp(argv[i], "--save-traces") == 0 && i + 1 < argc) {
+            save_path = argv[++i];
+        } else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            csv_path = argv[++i];
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (strcmp(argv[i], "--set") == 0 && i + 1 < argc && setConfigField(config, argv[i + 1])) {
+            ++i;
+        } else {
+            fprintf(stderr, "usage: %s [--trace <file>] [--save-traces <file>] [--csv <file>] [--json <file>] [--set <field>=<value>]...\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<Trace> traces;
+    if (trace_path != nullptr) {
+        Trace trace;
+        if (!loadTrace(trace_path, config, trace)) {
+            return 1;
+        }
+        traces.push_back(trace);
+    } else {
+        traces.push_back(makeDockTrace("dock_60hz", config, dt60));
+        traces.push_back(makeDockTrace("dock_144hz", config, dt144));
+        traces.push_back(makeDockTrace("dock_uneven", config, dtUneven));
+    }
+    if (save_path != nullptr && !writeTrace(save_path, traces)) {
+        return 1;
+    }
+
+    std::vector<TraceResult> results;
+    printf("%-14s %7s %10s %12s %14s %12s %12s\n", "trace", "frames", "episodes", "peak ms", "settle ms", "overshoot", "jitter px");
+    for (const Trace& trace : traces) {
+        const TraceResult result = replayTrace(trace, config);
+        float peak_ms = 0.0f, settle_ms = 0.0f, overshoot = 0.0f;
+        for (const Episode& ep : result.episodes) {
+            peak_ms   = ImMax(peak_ms, ep.time_to_peak_ms);
+            settle_ms = ImMax(settle_ms, ep.time_to_settle_ms);
+            overshoot = ImMax(overshoot, ep.overshoot_px);
+        }
+        printf("%-14s %7d %10d %12.1f %14.1f %12.3f %12.4f\n", result.name.c_str(), result.frames, (int)result.episodes.size(), peak_ms, settle_ms,
+               overshoot, result.jitter_rms_px);
+        results.push_back(result);
+    }
+    if (csv_path != nullptr && !writeCsv(csv_path, results)) {
+        return 1;
+    }
+    if (json_path != nullptr && !writeJson(json_path, config, results)) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+MIT License
+
+Copyright (c) 2025 NewYaroslav
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+// Input-trace recorder for ImCoolBar_replay: call RecordFrame() once per frame in your application, after
+// the bar was submitted, and replay the file with "ImCoolBar_replay --trace <file>".
+// Header-only, include it from the application that records.
+
+#include "ImCoolBar.h"
+#include "imgui_internal.h"
+#include <cstdio>
+#include <cstring>
+
+/// \brief Writes the frames of one bar as an ImCoolBar_replay trace.
+/// \details Each frame is written as "<dt_ms> <mouse_x> <mouse_y>", the mouse relative to the bottom center of
+/// the bar window. The "# origin: bar" line tells the replay to add its own bar's bottom center, so the trace
+/// fits its bar if both are horizontal, anchored at the bottom center and have the same item count (12) and
+/// config (pass the sizes with --set). Frames without a valid mouse position are written far outside the bar.
+/// \code
+/// ImCoolBarTraceRecorder recorder;
+/// recorder.Open("dock.trace", "##Dock");
+/// // each frame, after EndCoolBar():
+/// recorder.RecordFrame();
+/// \endcode
+class ImCoolBarTraceRecorder {
+public:
+    ImCoolBarTraceRecorder() = default;
+    ~ImCoolBarTraceRecorder() { Close(); }
+
+    /// \brief Start a trace file.
+    /// \param vPath Trace file (overwritten).
+    /// \param vLabel Window label of the recorded bar.
+    /// \return \c false if the file cannot be opened.
+    bool Open(const char* vPath, const char* vLabel) {
+        Close();
+        m_file_ptr = fopen(vPath, "w");
+        if (m_file_ptr == nullptr) {
+            return false;
+        }
+        m_label.resize((int)strlen(vLabel) + 1);
+        memcpy(m_label.Data, vLabel, (size_t)m_label.Size);
+        fprintf(m_file_ptr, "# trace %s: <dt_ms> <mouse_x> <mouse_y>\n# origin: bar\n", vLabel);
+        return true;
+    }
+
+    /// \brief Close the trace file.
+    void Close() {
+        if (m_file_ptr != nullptr) {
+            fclose(m_file_ptr);
+            m_file_ptr = nullptr;
+        }
+    }
+
+    /// \brief Write this frame's DeltaTime and mouse position. Skipped until the bar window exists.
+    void RecordFrame() {
+        if (m_file_ptr == nullptr) {
+            return;
+        }
+        const ImGuiWindow* window_ptr = ImGui::FindWindowByName(m_label.Data);
+        if (window_ptr == nullptr) {
+            return;
+        }
+        const ImGuiIO& io = ImGui::GetIO();
+        ImVec2 mouse(-10000.0f, -10000.0f);
+        if (ImGui::IsMousePosValid(&io.MousePos)) {
+            mouse.x = io.MousePos.x - (window_ptr->Pos.x + window_ptr->Size.x * 0.5f);
+            mouse.y = io.MousePos.y - (window_ptr->Pos.y + window_ptr->Size.y);
+        }
+        fprintf(m_file_ptr, "%.4f %.3f %.3f\n", io.DeltaTime * 1000.0f, mouse.x, mouse.y);
+    }
+
+private:
+    ImCoolBarTraceRecorder(const ImCoolBarTraceRecorder&);
+    ImCoolBarTraceRecorder& operator=(const ImCoolBarTraceRecorder&);
+
+    FILE*          m_file_ptr = nullptr;
+    ImVector<char> m_label;  ///< Window label, null-terminated.
+};